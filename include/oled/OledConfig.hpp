@@ -9,6 +9,7 @@
  * - Arduino (Wire) - автоопределение или -DOLED_PLATFORM_ARDUINO=1
  * - STM32 HAL      - -DOLED_PLATFORM_STM32HAL=1
  * - ESP-IDF        - -DOLED_PLATFORM_ESPIDF=1 (будущее)
+ * - Host           - -DOLED_PLATFORM_HOST=1 (unit-тесты, симулятор)
  */
 
 #ifndef OLED_CONFIG_HPP
@@ -36,6 +37,10 @@
 #ifndef OLED_USE_ESPIDF
     #define OLED_USE_ESPIDF 0
 #endif
+// Host сборка (unit-тесты, симулятор на ПК) - без платформенного I2C
+#ifndef OLED_USE_HOST
+    #define OLED_USE_HOST 0
+#endif
 
 // Явное указание платформы через build_flags
 #if defined(OLED_PLATFORM_STM32HAL) && OLED_PLATFORM_STM32HAL
@@ -44,6 +49,9 @@
 #elif defined(OLED_PLATFORM_ESPIDF) && OLED_PLATFORM_ESPIDF
     #undef OLED_USE_ESPIDF
     #define OLED_USE_ESPIDF 1
+#elif defined(OLED_PLATFORM_HOST) && OLED_PLATFORM_HOST
+    #undef OLED_USE_HOST
+    #define OLED_USE_HOST 1
 #elif defined(OLED_PLATFORM_ARDUINO) && OLED_PLATFORM_ARDUINO
     #undef OLED_USE_ARDUINO
     #define OLED_USE_ARDUINO 1
@@ -54,8 +62,8 @@
 #endif
 
 // Проверка: хотя бы одна платформа должна быть определена
-#if OLED_ENABLED && !OLED_USE_ARDUINO && !OLED_USE_STM32HAL && !OLED_USE_ESPIDF
-    #error "OLED: No platform defined. Use -DOLED_PLATFORM_ARDUINO=1, -DOLED_PLATFORM_STM32HAL=1 or -DOLED_PLATFORM_ESPIDF=1"
+#if OLED_ENABLED && !OLED_USE_ARDUINO && !OLED_USE_STM32HAL && !OLED_USE_ESPIDF && !OLED_USE_HOST
+    #error "OLED: No platform defined. Use -DOLED_PLATFORM_ARDUINO=1, -DOLED_PLATFORM_STM32HAL=1, -DOLED_PLATFORM_ESPIDF=1 or -DOLED_PLATFORM_HOST=1"
 #endif
 
 // === Размеры буферов ===
@@ -70,6 +78,50 @@
 // Максимальный размер framebuffer (128x64 / 8 = 1024 байт)
 #define OLED_MAX_BUFFER_SIZE ((OLED_MAX_WIDTH * OLED_MAX_HEIGHT) / 8)
 
+// === Теневая копия GDDRAM ===
+// flush() сравнивает кадр с копией содержимого контроллера и передаёт
+// только реально изменённые байты. Стоит ещё OLED_MAX_BUFFER_SIZE байт RAM.
+#ifndef OLED_SHADOW_BUFFER
+    #define OLED_SHADOW_BUFFER 0
+#endif
+
+// === Программный поворот 90/270 ===
+// Рисование в логический холст H x W, flush() поворачивает изменённые блоки 8x8
+// в кадр панели. Стоит ещё OLED_MAX_BUFFER_SIZE байт RAM.
+#ifndef OLED_SOFT_ROTATION
+    #define OLED_SOFT_ROTATION 0
+#endif
+
+// === Буферы кадра для present() ===
+// 2 - следующий кадр рисуется во время DMA передачи предыдущего,
+// 3 - present() не ждёт шину (кадр в очереди заменяется более новым).
+// Каждый буфер сверх первого стоит OLED_MAX_BUFFER_SIZE байт RAM.
+// Действует на платформах с DMA (STM32 HAL), иначе present() = flush().
+#ifndef OLED_FRAME_BUFFERS
+    #define OLED_FRAME_BUFFERS 1
+#endif
+
+#if OLED_FRAME_BUFFERS < 1 || OLED_FRAME_BUFFERS > 3
+    #error "OLED: OLED_FRAME_BUFFERS must be 1, 2 or 3"
+#endif
+
+// === Переносимые ядра без SIMD ===
+// 1 - отключить SSE2/NEON ветки (транспонирование 8x8, поиск ASCII в print())
+// на host: выполняется тот же код, что и на Cortex-M.
+#ifndef OLED_NO_SIMD
+    #define OLED_NO_SIMD 0
+#endif
+
+// Максимум окон (runs) на страницу при сравнении с теневой копией
+#ifndef OLED_DIFF_MAX_RUNS
+    #define OLED_DIFF_MAX_RUNS 8
+#endif
+
+// Максимум строк в TextLayout (8 байт RAM на строку)
+#ifndef OLED_TEXT_MAX_LINES
+    #define OLED_TEXT_MAX_LINES 8
+#endif
+
 // Размер буфера для printf
 #define OLED_PRINTF_BUFFER_SIZE 128
 
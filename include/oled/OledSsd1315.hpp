@@ -15,7 +15,13 @@
 
 #include "OledConfig.hpp"
 #include "OledTypes.hpp"
+#include "domain/Bitmap.hpp"
+#include "domain/Font.hpp"
+#include "domain/Polygon.hpp"
+#include "domain/TextLayout.hpp"
+#include "ports/IByteReader.hpp"
 #include <cstdint>
+#include <cstddef>
 #include <cstdarg>
 #include <memory>
 
@@ -160,6 +166,117 @@ public:
      */
     OledResult invert(bool on);
 
+    /**
+     * @brief Начальная строка GDDRAM - аппаратная вертикальная прокрутка
+     * @param line 0-63 (изображение сдвигается вверх на line строк)
+     * @note Координаты рисования не меняются, см. setViewOrigin()
+     */
+    OledResult setStartLine(uint8_t line);
+
+    /**
+     * @brief Вертикальное смещение COM (SET_DISPLAY_OFFSET)
+     * @param offset 0-63
+     */
+    OledResult setDisplayOffset(uint8_t offset);
+
+    /**
+     * @brief Прокрутка по кольцу страниц без перерисовки экрана
+     *
+     * Верхней строкой экрана становится физическая страница page буфера и
+     * GDDRAM (Gfx::setRingOrigin + SET_START_LINE page * 8). Координаты
+     * рисования остаются экранными: после setViewOrigin(viewOrigin() + 1)
+     * изображение сдвинуто вверх на 8 строк, в нижней странице - бывшая
+     * верхняя. Её перерисовывают, и flush() передаёт одну команду и одну
+     * страницу вместо всего кадра. Команда уходит при следующем flush().
+     *
+     * @param page Страница 0-7 (по модулю числа страниц)
+     * @return Unsupported если высота не 64 строки или поворот 90/270
+     */
+    OledResult setViewOrigin(uint8_t page);
+
+    /**
+     * @brief Текущее начало кольца страниц (0 - без прокрутки)
+     */
+    uint8_t viewOrigin() const;
+
+    /**
+     * @brief Двойная буферизация в GDDRAM для панелей 128x32
+     *
+     * Контроллер хранит 64 строки, панель 32 показывает половину. В этом
+     * режиме flush() пишет кадр в скрытую половину и показывает её одной
+     * командой SET_START_LINE (2 байта): изображение меняется целиком, без
+     * разрывов посреди передачи. Изменения передаются за два кадра
+     * (каждая половина догоняет свой), с OLED_SHADOW_BUFFER - по теневой
+     * копии каждой половины.
+     *
+     * @return Unsupported если высота не 32 (или теневой копии не хватает
+     *         на обе половины)
+     * @note flushDMA() и scrollContent() в этом режиме возвращают Unsupported
+     */
+    OledResult setPageFlip(bool on);
+
+    /**
+     * @brief Включена ли двойная буферизация в GDDRAM
+     */
+    bool pageFlip() const;
+
+    // === Аппаратная прокрутка ===
+
+    /**
+     * @brief Непрерывная горизонтальная прокрутка страниц startPage..endPage
+     *
+     * Перед запуском передаёт несохранённые изменения. Пока прокрутка
+     * активна, flush() с изменениями возвращает Busy (запись в GDDRAM
+     * запрещена); после stopScroll() кадр передаётся заново.
+     *
+     * @param interval Кадров между шагами
+     */
+    OledResult scrollHorizontal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                ScrollInterval interval);
+
+    /**
+     * @brief Непрерывная диагональная прокрутка
+     * @param verticalOffset Строк вверх за шаг в области setVerticalScrollArea()
+     * @see scrollHorizontal
+     */
+    OledResult scrollDiagonal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                              ScrollInterval interval, uint8_t verticalOffset);
+
+    /**
+     * @brief Область вертикальной прокрутки: fixedRows неподвижных строк сверху,
+     *        под ними scrollRows прокручиваемых
+     */
+    OledResult setVerticalScrollArea(uint8_t fixedRows, uint8_t scrollRows);
+
+    /**
+     * @brief Остановить непрерывную прокрутку
+     *
+     * Контроллер сдвинул GDDRAM на неизвестное число шагов: весь буфер
+     * помечается изменённым, следующий flush() восстановит изображение.
+     */
+    OledResult stopScroll();
+
+    /**
+     * @brief Сдвинуть окно на одну колонку средствами контроллера (2Ch/2Dh)
+     *
+     * Буфер сдвигается так же, как GDDRAM: колонка, ушедшая за край окна,
+     * появляется с противоположной стороны. Для бегущей строки достаточно
+     * перерисовать открывшуюся колонку - flush() передаст только её.
+     * Перед сдвигом передаются несохранённые изменения.
+     *
+     * @code
+     * display.scrollContent(ScrollDirection::Left, 6, 7, 0, 127);
+     * display.blit(127, 48, 1, 16, tickerColumn(next++));
+     * display.flush();  // 2 байта данных
+     * @endcode
+     *
+     * @param startPage, endPage Страницы GDDRAM (с учётом setViewOrigin())
+     * @param startCol, endCol Колонки окна включительно
+     * @return Unsupported при повороте 90/270, Busy при непрерывной прокрутке
+     */
+    OledResult scrollContent(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                             uint8_t startCol, uint8_t endCol);
+
     // === Буфер ===
 
     /**
@@ -174,10 +291,61 @@ public:
     void fill(bool color);
 
     /**
-     * @brief Отправить буфер на дисплей
+     * @brief Отправить изменения буфера на дисплей
+     *
+     * Передаются только dirty-регионы (изменённые колонки каждой страницы).
+     * Если с прошлого flush() ничего не рисовалось - шина не используется.
      */
     OledResult flush();
 
+    /**
+     * @brief Отдать готовый кадр на передачу и продолжить рисование
+     *
+     * С OLED_FRAME_BUFFERS 2-3 (STM32 HAL) изменённые окна кадра уходят по DMA
+     * прямо из своего буфера (очередь flushDMA()), а рисование продолжается в
+     * свободном буфере - копии только что показанного.
+     * Пока идёт передача: 2 буфера - Busy (рисование можно
+     * продолжать, present() повторить), 3 буфера - кадр встаёт в очередь и
+     * уходит из onDmaComplete(); ещё не отправленный кадр заменяется новым.
+     * Без DMA или с одним буфером - то же, что flush().
+     *
+     * @return Ok, если кадр передан или поставлен в очередь
+     */
+    OledResult present();
+
+    /**
+     * @brief Начать передачу изменений без ожидания шины
+     *
+     * Те же страницы и колонки, что у flush(), но через II2c::writeAsync():
+     * управление возвращается сразу, передачу продвигают callback адаптера
+     * или poll() (см. setAsyncDrive()). Без асинхронного адаптера кадр
+     * передаётся до возврата, как flush().
+     *
+     * @warning До окончания передачи (poll() != Busy) не рисуйте:
+     *          байты кадра читаются прямо из буфера
+     * @return Ok если передача начата, Busy если предыдущая не закончена,
+     *         Unsupported в режиме page flip
+     */
+    OledResult flushAsync();
+
+    /**
+     * @brief Продвинуть асинхронную передачу
+     * @return Busy пока flushAsync() не закончен, затем его результат
+     */
+    OledResult poll();
+
+    /**
+     * @brief Кто продвигает flushAsync(): poll() (по умолчанию) или callback адаптера
+     */
+    void setAsyncDrive(AsyncDrive drive);
+
+    /**
+     * @brief Пометить весь буфер изменённым (следующий flush() отправит всё)
+     *
+     * Нужно, если содержимое GDDRAM потеряно (например, после сброса питания дисплея).
+     */
+    void invalidate();
+
     // === Примитивы ===
 
     /**
@@ -200,6 +368,78 @@ public:
      */
     void rectFill(int x, int y, int w, int h, bool color);
 
+    /**
+     * @brief Нарисовать окружность / залитый круг
+     */
+    void circle(int x0, int y0, int r, bool color);
+    void circleFill(int x0, int y0, int r, bool color);
+
+    /**
+     * @brief Нарисовать эллипс / залитый эллипс (полуоси до 511)
+     */
+    void ellipse(int x0, int y0, int rx, int ry, bool color);
+    void ellipseFill(int x0, int y0, int rx, int ry, bool color);
+
+    /**
+     * @brief Нарисовать дугу: углы в градусах, 0 = направо, по часовой стрелке
+     */
+    void arc(int x0, int y0, int r, int startDeg, int endDeg, bool color);
+
+    /**
+     * @brief Нарисовать прямоугольник со скруглёнными углами (контур / залитый)
+     */
+    void roundRect(int x, int y, int w, int h, int r, bool color);
+    void roundRectFill(int x, int y, int w, int h, int r, bool color);
+
+    /**
+     * @brief Залить многоугольник (стрелки, указатели индикаторов)
+     * @param edges Буфер рёбер на count элементов (без кучи)
+     * @return false если вершин меньше 3 или буфера рёбер не хватает
+     */
+    bool polygonFill(const Point* points, size_t count,
+                     PolygonEdge* edges, size_t edgeCapacity, bool color);
+
+    /**
+     * @brief Залить треугольник
+     */
+    void triangleFill(int x0, int y0, int x1, int y1, int x2, int y2, bool color);
+
+    /**
+     * @brief Нарисовать битмап в формате страниц (иконки, спрайты)
+     * @param src ceil(h / 8) страниц по w байт, LSB = верхний пиксель
+     * @param op Растровая операция (Copy, Or, And, Xor, AndNot, Not)
+     */
+    void blit(int x, int y, int w, int h, const uint8_t* src, RasterOp op = RasterOp::Copy);
+
+    /**
+     * @brief Нарисовать битмап, сконвертированный toPageBitmap()
+     */
+    template <uint16_t W, uint16_t H>
+    void blit(int x, int y, const PageBitmap<W, H>& bmp, RasterOp op = RasterOp::Copy) {
+        blit(x, y, W, H, bmp.bits(), op);
+    }
+
+    /**
+     * @brief Сдвинуть содержимое области на (dx, dy), открывшееся залить fill
+     *
+     * Консоль, графики-самописцы, переходы между экранами: flush()
+     * передаёт только область, без перерисовки остального.
+     */
+    void scroll(int x, int y, int w, int h, int dx, int dy, bool fill = false);
+
+    /**
+     * @brief Нарисовать изображение PBM/XBM/1bpp BMP из памяти
+     * @return InvalidArg если файл повреждён, Unsupported для неподдерживаемого варианта
+     * @see ImageImport.hpp
+     */
+    OledResult drawImage(const uint8_t* data, size_t size, int x, int y,
+                         RasterOp op = RasterOp::Copy);
+
+    /**
+     * @brief Нарисовать изображение, читая его потоком (внешняя flash, SD)
+     */
+    OledResult drawImage(IByteReader& reader, int x, int y, RasterOp op = RasterOp::Copy);
+
     // === Текст ===
 
     /**
@@ -217,6 +457,12 @@ public:
      */
     void setTextColor(bool color);
 
+    /**
+     * @brief Установить пропорциональный шрифт (nullptr = встроенный 5x7)
+     * @see Font.hpp, scripts/bdf2font.py
+     */
+    void setFont(const Font* font);
+
     /**
      * @brief Вывести строку
      */
@@ -228,6 +474,31 @@ public:
      */
     void printf(const char* fmt, ...);
 
+    /**
+     * @brief Ширина текста текущим шрифтом в пикселях (без отрисовки)
+     */
+    int measureText(const char* str) const;
+
+    /**
+     * @brief Разметить текст: перенос по словам, выравнивание, многоточие
+     * @param maxWidth Ширина области (0 = без переноса)
+     * @param maxLines Максимум строк (0 = TextLayout::MAX_LINES)
+     * @see TextLayout.hpp
+     */
+    void layoutText(TextLayout& layout, const char* str, int maxWidth = 0,
+                    TextAlign align = TextAlign::Left, uint8_t maxLines = 0) const;
+
+    /**
+     * @brief Нарисовать готовую разметку (курсор print() не меняется)
+     */
+    void drawText(const TextLayout& layout, int x, int y);
+
+    /**
+     * @brief Нарисовать строку 5x7, повёрнутую на 90/180/270 (подписи осей)
+     * @param x, y Левый верхний угол первого символа
+     */
+    void drawTextRotated(int x, int y, const char* str, Rotation rotation);
+
     // === Диагностика (Фаза 1) ===
 
     /**
@@ -253,7 +524,13 @@ public:
 
 #if OLED_USE_STM32HAL
     /**
-     * @brief Отправить буфер на дисплей через DMA (non-blocking)
+     * @brief Отправить изменения буфера на дисплей через DMA (non-blocking)
+     *
+     * Каждая изменённая область - окно адресации и данные, дескрипторы
+     * очереди запускаются один за другим из onDmaComplete().
+     * DMA читает кадр прямо из буфера рисования (перед ним зарезервирован
+     * байт 0x40), без копии: до isDMAComplete() не рисуйте, или используйте
+     * present() с OLED_FRAME_BUFFERS 2-3.
      * @return OledResult::Ok если передача начата
      * @note Требует настроенный DMA для I2C TX
      */
@@ -267,6 +544,8 @@ public:
     /**
      * @brief Callback для завершения DMA передачи
      *
+     * Запускает следующую передачу; если кадр из очереди present() не
+     * стартовал - I2cError и весь буфер помечается изменённым.
      * Вызывайте этот метод из HAL_I2C_MasterTxCpltCallback:
      * @code
      * void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
@@ -276,6 +555,20 @@ public:
      */
     void onDmaComplete();
 
+    /**
+     * @brief Callback для ошибки DMA передачи
+     *
+     * Вызывайте из HAL_I2C_ErrorCallback. Передача прерывается, буфер
+     * помечается изменённым (следующий flush() отправит весь кадр),
+     * getLastResult() возвращает I2cError.
+     * @code
+     * void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+     *     display.onDmaError();
+     * }
+     * @endcode
+     */
+    void onDmaError();
+
     /**
      * @brief Восстановить I2C шину после зависания
      * @param gpioPort Порт GPIO (например GPIOB)
@@ -287,6 +580,11 @@ public:
 #endif
 
 private:
+#if OLED_USE_STM32HAL
+    // Завершение передачи адаптера: дескриптор очереди flushDMA()/present() или шаг flushAsync()
+    void finishAdapterDma(bool ok);
+#endif
+
 #if OLED_ENABLED
     // pImpl - скрывает платформенные зависимости от публичного API
     detail::OledSsd1315Impl* pImpl_ = nullptr;
@@ -9,10 +9,14 @@
 #ifndef OLED_SSD1315_FWD_HPP
 #define OLED_SSD1315_FWD_HPP
 
+#include <cstdint>
+
 namespace oled {
 
 class OledSsd1315;
-class Gfx;
+template <uint16_t W, uint16_t H>
+class BasicGfx;
+using Gfx = BasicGfx<0, 0>;   // Размер в runtime
 class Ssd1315Driver;
 struct OledConfig;
 enum class OledResult;
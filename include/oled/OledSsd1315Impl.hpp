@@ -13,6 +13,9 @@
 #include "OledTypes.hpp"
 #include "domain/Ssd1315Driver.hpp"
 #include "domain/Gfx.hpp"
+#include "domain/FrameDiff.hpp"
+#include "domain/FrameRotate.hpp"
+#include "domain/FrameDmaQueue.hpp"
 
 #if OLED_ENABLED
     #if OLED_USE_ARDUINO
@@ -20,12 +23,31 @@
         #include "adapters/WireI2cAdapter.hpp"
     #elif OLED_USE_STM32HAL
         #include "adapters/Stm32HalI2cAdapter.hpp"
+        #if OLED_FRAME_BUFFERS > 1
+            #include <atomic>
+        #endif
     #endif
 #endif
 
 namespace oled {
 namespace detail {
 
+#if OLED_ENABLED
+/**
+ * @brief Буфер кадра с зарезервированным байтом перед пикселями
+ *
+ * data[0] - control byte 0x40 (Co=0, D/C#=1), data[1..] - пиксели для Gfx.
+ * Кадр уходит в GDDRAM одной передачей прямо из буфера, без копии.
+ * Gfx пишет только в pixels(), префикс не меняется.
+ */
+struct PrefixedFrame {
+    uint8_t data[1 + OLED_MAX_BUFFER_SIZE] = {cmd::CONTROL_DATA};
+
+    uint8_t* pixels() { return data + 1; }
+    const uint8_t* pixels() const { return data + 1; }
+};
+#endif
+
 /**
  * @brief Внутренняя реализация OledSsd1315
  *
@@ -44,13 +66,55 @@ struct OledSsd1315Impl {
 
     Ssd1315Driver driver;
     Gfx gfx;
-    uint8_t buffer[OLED_MAX_BUFFER_SIZE] = {0};
+    PrefixedFrame buffer;
+
+    #if OLED_SOFT_ROTATION
+    // При повороте 90/270 gfx - логический холст, panel - кадр в раскладке панели
+    Gfx panel;
+    PrefixedFrame panelBuffer;
+    Rotation rotation = Rotation::R0;
+    #endif
+
+    #if OLED_SHADOW_BUFFER
+    // Копия того, что сейчас находится в GDDRAM контроллера
+    uint8_t shadow[OLED_MAX_BUFFER_SIZE] = {0};
+    bool shadowValid = false;
+    // Page flip: shadow хранит обе половины GDDRAM, бит h - половина h действительна
+    uint8_t shadowHalves = 0;
+    #else
+    // Page flip: скрытая половина отстаёт на кадр - dirty-колонки прошлого кадра
+    // по страницам, {x0, x1}; x0 > x1 - страница не менялась
+    uint8_t flipDirty[cmd::GDDRAM_ROWS / 16][2] = {};
+    #endif
     bool initialized = false;
+    // setViewOrigin(): SET_START_LINE при flush(); восстанавливается и из onDmaError()
+    volatile bool startLinePending = false;
+    bool asyncPending = false;      // Результат flushAsync() ещё не забран poll()
     OledResult lastResult = OledResult::Ok;
     const char* lastErrorMsg = nullptr;
 
     #if OLED_USE_STM32HAL
     volatile bool dmaInProgress = false;
+    // flushDMA() и present(): окна изменений, цепочка из onDmaComplete() через adapter.writeAsync()
+    FrameDmaQueue dmaQueue;
+
+    #if OLED_FRAME_BUFFERS > 1
+    // present(): слот 0 - буфер кадра панели (buffer или panelBuffer);
+    // slots указывают на pixels(), перед каждым - префикс для DMA
+    PrefixedFrame frames[OLED_FRAME_BUFFERS - 1];
+    uint8_t* slots[OLED_FRAME_BUFFERS] = {};
+    uint8_t drawSlot = 0;                 // Рисует приложение
+    volatile int8_t sendSlot = -1;        // Передаётся DMA
+    // Колонки страниц кадра слота - окна очереди dmaQueue
+    PageSpan slotSpans[OLED_FRAME_BUFFERS][cmd::GDDRAM_ROWS / 8] = {};
+    // SET_START_LINE перед окнами кадра слота (setViewOrigin()), -1 - без команды
+    int8_t slotStartLine[OLED_FRAME_BUFFERS] = {};
+    #if ATOMIC_CHAR_LOCK_FREE == 2
+    std::atomic<int8_t> pendingSlot{-1};  // Ждёт шину: обмен с onDmaComplete()
+    #else
+    volatile int8_t pendingSlot = -1;     // Cortex-M0/M0+: обмен под PRIMASK
+    #endif
+    #endif
     #endif
 #endif
 };
@@ -39,6 +39,82 @@ enum class VccMode {
     ExternalVcc         // Внешнее VCC (0x8D, 0x10)
 };
 
+/**
+ * @brief Растровая операция для blit: dst = op(dst, src)
+ */
+enum class RasterOp : uint8_t {
+    Copy,   // src
+    Or,     // dst | src
+    And,    // dst & src
+    Xor,    // dst ^ src
+    AndNot, // dst & ~src (стереть пиксели src)
+    Not     // ~src
+};
+
+/**
+ * @brief Выравнивание строк текста в TextLayout
+ */
+enum class TextAlign : uint8_t {
+    Left,
+    Center,
+    Right
+};
+
+/**
+ * @brief Поворот изображения по часовой стрелке
+ *
+ * R180 - аппаратно (remap контроллера). R90/R270 - программно: рисование
+ * идёт в логический портретный холст, flush() поворачивает его блоками 8x8
+ * (нужен OLED_SOFT_ROTATION). Для текста поперёк экрана без поворота
+ * всего кадра - Gfx::drawTextRotated().
+ */
+enum class Rotation : uint8_t {
+    R0,
+    R90,
+    R180,
+    R270
+};
+
+/**
+ * @brief Направление аппаратной горизонтальной прокрутки
+ */
+enum class ScrollDirection : uint8_t {
+    Right,  // К старшим адресам колонок GDDRAM
+    Left    // К младшим адресам колонок GDDRAM
+};
+
+/**
+ * @brief Интервал между шагами аппаратной прокрутки
+ *
+ * Значения - коды интервала команд 26h/27h/29h/2Ah SSD1315.
+ */
+enum class ScrollInterval : uint8_t {
+    Frames2   = 0x07,
+    Frames3   = 0x04,
+    Frames4   = 0x05,
+    Frames5   = 0x06,
+    Frames6   = 0x00,
+    Frames32  = 0x01,
+    Frames64  = 0x02,
+    Frames128 = 0x03
+};
+
+/**
+ * @brief Колонки страницы для асинхронной передачи (x0 > x1 - страница пропускается)
+ */
+struct PageSpan {
+    uint8_t x0;
+    uint8_t x1;
+};
+
+/**
+ * @brief Кто продвигает асинхронную передачу кадра
+ */
+enum class AsyncDrive : uint8_t {
+    Poll,     // poll() из основного цикла; callback адаптера только отмечает завершение
+    Callback  // Callback адаптера сразу запускает следующую передачу (ISR, DMA)
+};
+
 /**
  * @brief Тип callback для управления GPIO reset
  * @param high true = установить HIGH, false = установить LOW
@@ -69,6 +145,7 @@ struct OledConfig {
     uint32_t i2cFreq  = 400000;    // Частота I2C (опционально)
     VccMode  vccMode  = VccMode::InternalChargePump;
     bool     flip180  = false;     // Поворот на 180 градусов
+    Rotation rotation = Rotation::R0; // Поворот (R90/R270 - OLED_SOFT_ROTATION)
     
     /**
      * @brief Callback для аппаратного reset (platform-agnostic)
@@ -93,6 +93,59 @@ public:
         return (status == HAL_OK);
     }
 
+    /**
+     * @brief Начать передачу по DMA (HAL_I2C_Master_Transmit_DMA)
+     *
+     * data должна оставаться неизменной до callback. Завершение сообщает
+     * onTxComplete() из HAL_I2C_MasterTxCpltCallback (через
+     * OledSsd1315::onDmaComplete()).
+     * @return false если шина занята или HAL отказал
+     */
+    bool writeAsync(uint8_t addr7, const uint8_t* data, size_t len,
+                    WriteCallback callback, void* context) override {
+        if (!hi2c_ || !data || len == 0 || len > 0xFFFF || busy_) {
+            return false;
+        }
+
+        callback_ = callback;
+        context_ = context;
+        busy_ = true;
+
+        uint16_t addr8 = static_cast<uint16_t>(addr7) << 1;
+        HAL_StatusTypeDef status = HAL_I2C_Master_Transmit_DMA(
+            hi2c_,
+            addr8,
+            const_cast<uint8_t*>(data),
+            static_cast<uint16_t>(len)
+        );
+        if (status != HAL_OK) {
+            busy_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    bool busy() const override {
+        return busy_;
+    }
+
+    /**
+     * @brief Завершение DMA передачи writeAsync() (вызывать из ISR)
+     * @param ok false - ошибка шины (HAL_I2C_ErrorCallback)
+     */
+    void onTxComplete(bool ok) {
+        if (!busy_) {
+            return;
+        }
+        // Callback может сразу начать следующую передачу
+        WriteCallback callback = callback_;
+        void* context = context_;
+        busy_ = false;
+        if (callback) {
+            callback(context, ok);
+        }
+    }
+
     /**
      * @brief Проверить наличие устройства на шине
      * @param addr7 7-битный адрес устройства
@@ -117,6 +170,9 @@ public:
 private:
     I2C_HandleTypeDef* hi2c_;
     uint32_t timeout_;
+    WriteCallback callback_ = nullptr;
+    void* context_ = nullptr;
+    volatile bool busy_ = false;
 };
 
 } // namespace oled
@@ -0,0 +1,98 @@
+/**
+ * @file Bitmap.hpp
+ * @brief Битмапы в формате страниц и их конвертация на этапе компиляции
+ *
+ * Графические редакторы выдают 1bpp битмапы построчно (XBM, PBM, "C array"),
+ * а framebuffer организован постранично (см. Gfx.hpp). toPageBitmap()
+ * выполняет перестановку бит в constexpr - результат лежит во flash
+ * и передаётся в blit() без преобразований во время работы.
+ *
+ * Пример:
+ * @code
+ * constexpr uint8_t kLogoRows[] = { 0x3C, 0x42, 0x81, ... };  // 8x8, MSB = левый пиксель
+ * constexpr auto kLogo = oled::toPageBitmap<8, 8>(kLogoRows);
+ * display.blit(0, 0, kLogo);
+ * @endcode
+ */
+
+#ifndef OLED_BITMAP_HPP
+#define OLED_BITMAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oled {
+
+/**
+ * @brief Порядок бит в байте построчного битмапа
+ */
+enum class BitOrder : uint8_t {
+    MsbFirst, // Старший бит = левый пиксель (PBM, большинство "C array" экспортов)
+    LsbFirst  // Младший бит = левый пиксель (XBM)
+};
+
+/**
+ * @brief Битмап в формате framebuffer
+ *
+ * pages страниц по width байт, каждый байт - 8 вертикальных пикселей,
+ * LSB = верхний пиксель страницы.
+ */
+template <uint16_t W, uint16_t H>
+struct PageBitmap {
+    static_assert(W > 0 && H > 0, "PageBitmap: empty bitmap");
+
+    static constexpr uint16_t width = W;
+    static constexpr uint16_t height = H;
+    static constexpr uint16_t pages = (H + 7) / 8;
+    static constexpr size_t size = static_cast<size_t>(W) * pages;
+
+    std::array<uint8_t, size> data{};
+
+    /**
+     * @brief Указатель на данные для Gfx::blit()
+     */
+    constexpr const uint8_t* bits() const { return data.data(); }
+};
+
+/**
+ * @brief Конвертировать построчный 1bpp битмап в формат страниц
+ *
+ * Каждая строка занимает ceil(W / 8) байт, лишние биты в конце строки
+ * игнорируются.
+ *
+ * @tparam W Ширина в пикселях
+ * @tparam H Высота в пикселях
+ * @tparam Order Порядок бит в байте строки
+ * @param rows Построчные данные (constexpr массив)
+ */
+template <uint16_t W, uint16_t H, BitOrder Order = BitOrder::MsbFirst, size_t N>
+constexpr PageBitmap<W, H> toPageBitmap(const uint8_t (&rows)[N]) {
+    constexpr size_t rowBytes = (W + 7) / 8;
+    static_assert(N >= rowBytes * H, "toPageBitmap: source array is smaller than W x H");
+
+    PageBitmap<W, H> out{};
+    for (uint16_t page = 0; page < out.pages; ++page) {
+        for (uint16_t x = 0; x < W; ++x) {
+            const uint8_t bitInByte = (Order == BitOrder::MsbFirst)
+                                      ? static_cast<uint8_t>(7 - (x & 7))
+                                      : static_cast<uint8_t>(x & 7);
+            uint8_t column = 0;
+            for (uint8_t bit = 0; bit < 8; ++bit) {
+                const uint16_t y = static_cast<uint16_t>(page * 8 + bit);
+                if (y >= H) {
+                    break;
+                }
+                if ((rows[y * rowBytes + x / 8] >> bitInByte) & 0x01) {
+                    column = static_cast<uint8_t>(column | (1 << bit));
+                }
+            }
+            out.data[static_cast<size_t>(page) * W + x] = column;
+        }
+    }
+    return out;
+}
+
+} // namespace oled
+
+#endif // OLED_BITMAP_HPP
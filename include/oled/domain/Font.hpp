@@ -0,0 +1,114 @@
+/**
+ * @file Font.hpp
+ * @brief Формат пропорциональных шрифтов
+ *
+ * Шрифт описывает диапазон codepoints [first, first + glyphCount).
+ * Для каждого глифа хранятся размер битмапа, смещения и шаг курсора.
+ *
+ * Битмапы хранятся по колонкам: колонка = height бит сверху вниз,
+ * колонки идут подряд без выравнивания (бит 0 байта - первый).
+ * Это тот же вертикальный порядок, что и в framebuffer, поэтому
+ * декодер пишет колонки прямо в байты страниц.
+ *
+ * FontEncoding::Rle: тот же поток бит, сжатый серийно - каждый байт
+ * хранит значение (бит 7) и длину серии минус 1 (биты 0-6).
+ *
+ * Заголовки шрифтов генерируются из BDF: scripts/bdf2font.py
+ */
+
+#ifndef OLED_FONT_HPP
+#define OLED_FONT_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace oled {
+
+/**
+ * @brief Способ хранения битмапов глифов
+ */
+enum class FontEncoding : uint8_t {
+    Packed, // Плотно упакованные колонки
+    Rle     // Серийное кодирование упакованного потока
+};
+
+/**
+ * @brief Описание одного глифа
+ */
+struct FontGlyph {
+    uint16_t offset;  // Смещение битмапа в Font::bitmap (байты)
+    uint8_t  width;   // Ширина битмапа (колонок)
+    uint8_t  height;  // Высота битмапа (до 32 пикселей)
+    uint8_t  advance; // Шаг курсора по X
+    int8_t   xOffset; // Смещение битмапа от курсора по X
+    int8_t   yOffset; // Смещение верха битмапа от верха строки
+};
+
+/**
+ * @brief Пара кернинга (индексы глифов внутри шрифта)
+ *
+ * Массив пар сортируется по (left, right) для бинарного поиска.
+ */
+struct FontKernPair {
+    uint16_t left;
+    uint16_t right;
+    int8_t   adjust;  // Поправка шага курсора (обычно отрицательная)
+};
+
+/**
+ * @brief Пропорциональный шрифт
+ */
+struct Font {
+    const uint8_t*      bitmap;       // Битмапы всех глифов
+    const FontGlyph*    glyphs;       // glyphCount описаний
+    uint32_t            first;        // Первый codepoint
+    uint16_t            glyphCount;   // Количество глифов в диапазоне
+    uint8_t             lineHeight;   // Шаг строки
+    uint8_t             baseline;     // Расстояние от верха строки до базовой линии
+    FontEncoding        encoding;     // Формат битмапов
+    const FontKernPair* kerning;      // Пары кернинга (может быть nullptr)
+    uint16_t            kerningCount; // Количество пар
+
+    /**
+     * @brief Найти глиф по codepoint
+     * @return Указатель на глиф или nullptr, если символ не входит в шрифт
+     */
+    const FontGlyph* glyph(uint32_t codepoint) const {
+        if (codepoint < first || codepoint - first >= glyphCount) {
+            return nullptr;
+        }
+        const FontGlyph* g = &glyphs[codepoint - first];
+        return (g->advance == 0 && g->width == 0) ? nullptr : g;
+    }
+
+    /**
+     * @brief Поправка кернинга между двумя глифами
+     */
+    int8_t kern(const FontGlyph* left, const FontGlyph* right) const {
+        if (!kerning || kerningCount == 0 || !left || !right) {
+            return 0;
+        }
+        const uint16_t l = static_cast<uint16_t>(left - glyphs);
+        const uint16_t r = static_cast<uint16_t>(right - glyphs);
+
+        size_t lo = 0;
+        size_t hi = kerningCount;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            const FontKernPair& p = kerning[mid];
+            if (p.left < l || (p.left == l && p.right < r)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo < kerningCount && kerning[lo].left == l && kerning[lo].right == r) {
+            return kerning[lo].adjust;
+        }
+        return 0;
+    }
+};
+
+} // namespace oled
+
+#endif // OLED_FONT_HPP
@@ -0,0 +1,59 @@
+/**
+ * @file FrameDiff.hpp
+ * @brief Побайтовое сравнение кадра с теневой копией GDDRAM
+ *
+ * Находит минимальный набор окон (runs) для передачи изменений.
+ * Близкие runs объединяются по модели стоимости: каждое окно стоит
+ * RUN_OVERHEAD байт адресации, поэтому разрыв короче этого выгоднее
+ * передать вместе с данными.
+ */
+
+#ifndef OLED_FRAME_DIFF_HPP
+#define OLED_FRAME_DIFF_HPP
+
+#include "../OledConfig.hpp"
+#include <cstdint>
+#include <cstddef>
+
+#if OLED_ENABLED
+
+namespace oled {
+
+/**
+ * @brief Диапазон изменённых колонок одной страницы (включительно)
+ */
+struct DiffRun {
+    uint8_t colStart;
+    uint8_t colEnd;
+};
+
+/**
+ * @brief Сравнение строки страницы кадра с теневой копией
+ */
+class FrameDiff {
+public:
+    /// Стоимость одного окна: control byte + SET_COLUMN_ADDR(3) + SET_PAGE_ADDR(3)
+    static constexpr size_t RUN_OVERHEAD = 7;
+
+    /**
+     * @brief Найти изменённые runs в строке страницы
+     *
+     * Разрывы не длиннее RUN_OVERHEAD склеиваются. Если runs больше,
+     * чем maxRuns, последний run расширяется до конца изменений.
+     *
+     * @param frame Строка страницы текущего кадра
+     * @param shadow Та же строка в теневой копии GDDRAM
+     * @param width Ширина строки в байтах
+     * @param runs Выходной массив
+     * @param maxRuns Ёмкость массива (> 0)
+     * @return Количество найденных runs (0 = строка не изменилась)
+     */
+    static size_t diffRow(const uint8_t* frame, const uint8_t* shadow, uint16_t width,
+                          DiffRun* runs, size_t maxRuns);
+};
+
+} // namespace oled
+
+#endif // OLED_ENABLED
+
+#endif // OLED_FRAME_DIFF_HPP
@@ -0,0 +1,126 @@
+/**
+ * @file FrameDmaQueue.hpp
+ * @brief Очередь DMA дескрипторов: окно адресации, затем данные окна
+ *
+ * Для каждого окна в очередь ставятся команды SET_COLUMN_ADDR/SET_PAGE_ADDR,
+ * затем данные страниц окна. Перед окнами может стоять SET_START_LINE кадра. Следующий дескриптор
+ * запускается из callback завершения (II2c::writeAsync), поэтому окна
+ * уходят подряд без участия основного цикла.
+ *
+ * Окно, которое начинается с начала кадра, передаётся прямо из кадра:
+ * перед ним зарезервирован байт под control byte 0x40 (PrefixedFrame).
+ * Остальные окна уходят по строкам страниц через буфер очереди с тем же
+ * префиксом (OLED_MAX_WIDTH + 1 байт): строка копируется перед своей
+ * передачей. Пиксели кадра очередь не меняет.
+ */
+
+#ifndef OLED_FRAME_DMA_QUEUE_HPP
+#define OLED_FRAME_DMA_QUEUE_HPP
+
+#include "../OledConfig.hpp"
+#include "../OledTypes.hpp"
+#include "../ports/II2c.hpp"
+#include "Ssd1315Commands.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#if OLED_ENABLED
+
+namespace oled {
+
+/**
+ * @brief Откуда берутся байты передачи
+ */
+enum class DmaSource : uint8_t {
+    Command,  // Команды окна из очереди
+    Frame,    // Кадр с зарезервированного префикса
+    Staged    // Строка страницы, копируется в буфер очереди за префиксом
+};
+
+/**
+ * @brief Одна передача DMA
+ */
+struct DmaDescriptor {
+    const uint8_t* data;  // Первый байт передачи; для Staged - первый пиксель строки
+    uint16_t len;         // Длина передачи вместе с control byte
+    DmaSource source;
+};
+
+/**
+ * @brief Очередь оконных передач кадра с цепочкой из callback завершения
+ */
+class FrameDmaQueue {
+public:
+    /// Окон не больше страниц GDDRAM
+    static constexpr uint8_t MAX_WINDOWS = cmd::GDDRAM_ROWS / 8;
+    /// SET_START_LINE, команда на окно и не больше одной передачи данных на страницу
+    static constexpr uint8_t MAX_DESCRIPTORS = 2 * MAX_WINDOWS + 1;
+    /// control byte + SET_COLUMN_ADDR(3) + SET_PAGE_ADDR(3)
+    static constexpr uint8_t WINDOW_CMD_SIZE = 7;
+
+    /**
+     * @brief Построить очередь по колонкам страниц
+     *
+     * Окно - страница с изменениями; подряд идущие страницы на всю ширину -
+     * одно окно (с начала кадра - с одной передачей данных).
+     *
+     * @param frame Пиксели кадра, frame[-1] зарезервирован (PrefixedFrame)
+     * @param width Ширина кадра
+     * @param spans Колонки для каждой из count страниц (x0 > x1 - пропустить)
+     * @param pageOffset Сдвиг страниц GDDRAM (Ssd1315Driver::backPage())
+     * @param startLine SET_START_LINE первым дескриптором (0-63), -1 - без команды
+     * @return Busy во время передачи, InvalidArg при неверных колонках или строке
+     */
+    OledResult build(const uint8_t* frame, uint16_t width, const PageSpan* spans, uint8_t count,
+                     uint8_t pageOffset = 0, int8_t startLine = -1);
+
+    /**
+     * @brief Запустить первую передачу очереди
+     * @return Ok если передача начата или очередь пуста, I2cError если
+     *         адаптер не принял передачу
+     */
+    OledResult start(II2c& i2c, uint8_t addr7);
+
+    /**
+     * @brief Идёт ли передача очереди
+     */
+    bool active() const { return active_; }
+
+    /**
+     * @brief Результат последней завершённой очереди
+     */
+    OledResult result() const { return result_; }
+
+    /**
+     * @brief Количество дескрипторов в очереди
+     */
+    uint8_t size() const { return count_; }
+
+    /**
+     * @brief Дескриптор очереди (index < size())
+     */
+    const DmaDescriptor& descriptor(uint8_t index) const { return queue_[index]; }
+
+private:
+    static void onTransferDone(void* context, bool ok);
+    bool startNext();
+    void finish(OledResult res);
+
+    uint8_t startLineCmd_[2] = {cmd::CONTROL_COMMAND, cmd::SET_START_LINE};
+    uint8_t windowCmds_[MAX_WINDOWS][WINDOW_CMD_SIZE] = {};
+    DmaDescriptor queue_[MAX_DESCRIPTORS] = {};
+    uint8_t count_ = 0;
+    uint8_t next_ = 0;
+
+    II2c* i2c_ = nullptr;
+    uint8_t addr7_ = 0;
+    uint8_t stage_[1 + OLED_MAX_WIDTH] = {cmd::CONTROL_DATA};  // Живёт до callback передачи
+    volatile bool active_ = false;
+    OledResult result_ = OledResult::Ok;
+};
+
+} // namespace oled
+
+#endif // OLED_ENABLED
+
+#endif // OLED_FRAME_DMA_QUEUE_HPP
@@ -0,0 +1,54 @@
+/**
+ * @file FrameRotate.hpp
+ * @brief Поворот кадра на 90/270 градусов блоками 8x8
+ *
+ * При повороте 90/270 рисование идёт в логический холст H x W
+ * (портрет для панели 128x64). Перед передачей изменённые блоки 8x8
+ * холста переносятся в кадр в раскладке панели: байт страницы -
+ * колонка из 8 пикселей, поэтому поворот блока - транспонирование
+ * битовой матрицы 8x8 (плюс порядок байт).
+ */
+
+#ifndef OLED_FRAME_ROTATE_HPP
+#define OLED_FRAME_ROTATE_HPP
+
+#include "../OledConfig.hpp"
+#include "../OledTypes.hpp"
+#include "Gfx.hpp"
+#include <cstdint>
+
+#if OLED_ENABLED
+
+namespace oled {
+
+/**
+ * @brief Транспонирование битовых блоков и поворот кадра
+ */
+class FrameRotate {
+public:
+    /**
+     * @brief Транспонировать битовую матрицу 8x8: out[i] бит j = in[j] бит i
+     *
+     * Hacker's Delight (3 шага обмена на 64-битном слове), на host с SSE2 -
+     * через pmovmskb (OLED_NO_SIMD=1 оставляет переносимый вариант).
+     * in и out могут совпадать.
+     */
+    static void transpose8x8(const uint8_t* in, uint8_t* out);
+
+    /**
+     * @brief Перенести изменённые блоки логического холста в кадр панели
+     *
+     * Холст logical - native.height() x native.width(), обе стороны кратны 8.
+     * Пересчитываются только блоки из dirty-регионов холста, в native они
+     * отмечаются изменёнными. Dirty-регионы холста не сбрасываются.
+     *
+     * @param rotation Rotation::R90 (по часовой) или Rotation::R270; иначе ничего
+     */
+    static void rotate(const Gfx& logical, Gfx& native, Rotation rotation);
+};
+
+} // namespace oled
+
+#endif // OLED_ENABLED
+
+#endif // OLED_FRAME_ROTATE_HPP
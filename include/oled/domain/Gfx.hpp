@@ -1,12 +1,23 @@
 /**
  * @file Gfx.hpp
  * @brief Графический слой: буфер, примитивы, текст
+ *
+ * Gfx (= BasicGfx<0, 0>) - размер задаётся в init(), буфер внешний.
+ * BasicGfx<W, H> - размер известен при компиляции, буфер встроен
+ * (std::array ровно на W * H / 8 байт); в константы сворачивается только
+ * pixel(). Остальные примитивы и текст общие.
  */
 
 #ifndef OLED_GFX_HPP
 #define OLED_GFX_HPP
 
 #include "../OledConfig.hpp"
+#include "../OledTypes.hpp"
+#include "Bitmap.hpp"
+#include "Font.hpp"
+#include "Polygon.hpp"
+#include "TextLayout.hpp"
+#include <array>
 #include <cstdint>
 #include <cstddef>
 
@@ -14,26 +25,31 @@
 
 namespace oled {
 
+template <uint16_t W, uint16_t H>
+class BasicGfx;
+
 /**
- * @brief Графический контекст для работы с framebuffer
+ * @brief Графический контекст для работы с framebuffer (размер в runtime)
  * 
  * Буфер организован постранично (page mode):
  * - каждая страница = 8 строк пикселей
  * - байт = 8 вертикальных пикселей в одной колонке
  * - LSB = верхний пиксель страницы
  */
-class Gfx {
+template <>
+class BasicGfx<0, 0> {
 public:
     /**
      * @brief Конструктор по умолчанию (для статического размещения)
      */
-    Gfx() : buffer_(nullptr), width_(0), height_(0) {}
+    BasicGfx() : buffer_(nullptr), width_(0), height_(0) {}
     
     /**
      * @brief Инициализация с буфером
      * @param buffer Внешний буфер (передаётся пользователем)
      * @param width Ширина дисплея в пикселях
-     * @param height Высота дисплея в пикселях (должна быть кратна 8)
+     * @param height Высота дисплея в пикселях (должна быть кратна 8); страницы
+     *        за MAX_PAGES рисуются, но в dirty-регионах не отслеживаются
      */
     void init(uint8_t* buffer, uint16_t width, uint16_t height);
     
@@ -41,6 +57,14 @@ public:
      * @brief Проверка инициализации
      */
     bool isInitialized() const { return buffer_ != nullptr; }
+
+    /**
+     * @brief Перейти на другой буфер того же размера (двойная буферизация)
+     *
+     * Курсор, шрифт, кольцо страниц и dirty-регионы сохраняются.
+     * @param buffer Буфер width * height / 8 байт
+     */
+    void setBuffer(uint8_t* buffer) { buffer_ = buffer; }
     
     /**
      * @brief Получить указатель на буфер
@@ -63,6 +87,67 @@ public:
      */
     uint16_t height() const { return height_; }
     
+    // === Dirty-регионы ===
+    
+    /// Максимальное количество страниц (OLED_MAX_HEIGHT / 8; с OLED_SOFT_ROTATION -
+    /// по большей стороне, для портретного холста)
+    static constexpr uint8_t MAX_PAGES =
+        ((OLED_SOFT_ROTATION && OLED_MAX_WIDTH > OLED_MAX_HEIGHT) ? OLED_MAX_WIDTH : OLED_MAX_HEIGHT) / 8;
+    
+    /**
+     * @brief Отметить область как изменённую
+     *
+     * Примитивы отмечают dirty-регионы сами. Вызывайте вручную
+     * только после прямой записи в buffer().
+     */
+    void markDirty(int x, int y, int w, int h);
+    
+    /**
+     * @brief Отметить весь буфер как изменённый
+     */
+    void markAllDirty();
+    
+    /**
+     * @brief Сбросить dirty-регионы (после успешной отправки)
+     */
+    void clearDirty();
+    
+    /**
+     * @brief Есть ли изменения с последнего clearDirty()
+     */
+    bool isDirty() const;
+    
+    /**
+     * @brief Получить диапазон изменённых колонок страницы
+     * @param page Номер страницы
+     * @param x0 Первая изменённая колонка
+     * @param x1 Последняя изменённая колонка (включительно)
+     * @return false если страница не изменялась
+     */
+    bool pageDirtyRange(uint8_t page, uint8_t& x0, uint8_t& x1) const;
+    
+    // === Кольцевая адресация страниц ===
+    
+    /**
+     * @brief Установить начало кольца страниц (прокрутка без копирования)
+     *
+     * Логическая страница p хранится в физической (p + page) % (height / 8).
+     * Примитивы работают в логических координатах, а buffer(), dirty-регионы
+     * и pageDirtyRange() - в физических, как GDDRAM. Увеличение начала на 1
+     * сдвигает изображение вверх на страницу: бывшая верхняя страница
+     * становится нижней, рисуется заново и передаётся одна. Пара -
+     * Ssd1315Driver::setStartLine(page * 8). Буфер не меняется.
+     *
+     * @param page Физическая страница логической страницы 0 (по модулю числа
+     *        страниц); игнорируется, если страниц больше MAX_PAGES
+     */
+    void setRingOrigin(uint8_t page);
+    
+    /**
+     * @brief Текущее начало кольца страниц
+     */
+    uint8_t ringOrigin() const { return ringOrigin_; }
+    
     // === Очистка и заливка ===
     
     /**
@@ -83,11 +168,29 @@ public:
      * @param x Координата X (0 = левый край)
      * @param y Координата Y (0 = верхний край)
      * @param color true = включён
+     *
+     * Inline: вызывается поточечно (circle, ellipse, arc, ImageImport::draw),
+     * вызов out-of-line стоил больше самой записи.
      */
-    void pixel(int x, int y, bool color);
+    void pixel(int x, int y, bool color) {
+        // Беззнаковое сравнение отсекает и отрицательные координаты
+        if (static_cast<unsigned>(x) >= width_ || static_cast<unsigned>(y) >= height_ || !buffer_) {
+            return;
+        }
+        const uint8_t mask = static_cast<uint8_t>(1u << (y & 7));
+        const int page = physPage(y >> 3);
+        uint8_t& byte = buffer_[static_cast<size_t>(page) * width_ + x];
+        byte = color ? static_cast<uint8_t>(byte | mask) : static_cast<uint8_t>(byte & ~mask);
+        markDirtyByte(x, page);
+    }
     
     /**
-     * @brief Нарисовать линию (алгоритм Брезенхэма)
+     * @brief Нарисовать линию
+     *
+     * Отрезок обрезается по экрану один раз, видимая часть рисуется
+     * целочисленным DDA прямо в байты страниц. Пиксели не зависят от
+     * порядка концов и от обрезки. Горизонтальные и вертикальные
+     * линии идут через span-движок.
      */
     void line(int x0, int y0, int x1, int y1, bool color);
     
@@ -101,6 +204,115 @@ public:
      */
     void rectFill(int x, int y, int w, int h, bool color);
     
+    /**
+     * @brief Нарисовать окружность (алгоритм средней точки)
+     */
+    void circle(int x0, int y0, int r, bool color);
+    
+    /**
+     * @brief Нарисовать залитый круг (вертикальные span по колонкам)
+     */
+    void circleFill(int x0, int y0, int r, bool color);
+    
+    /**
+     * @brief Нарисовать эллипс с полуосями rx, ry (до 511)
+     */
+    void ellipse(int x0, int y0, int rx, int ry, bool color);
+    
+    /**
+     * @brief Нарисовать залитый эллипс с полуосями rx, ry (до 511)
+     */
+    void ellipseFill(int x0, int y0, int rx, int ry, bool color);
+    
+    /**
+     * @brief Нарисовать дугу окружности
+     *
+     * Углы в градусах: 0 = направо (3 часа), рост по часовой стрелке
+     * (90 = вниз). Дуга идёт по часовой от startDeg до endDeg;
+     * разница 360 и больше - полная окружность.
+     */
+    void arc(int x0, int y0, int r, int startDeg, int endDeg, bool color);
+    
+    /**
+     * @brief Нарисовать прямоугольник со скруглёнными углами (контур)
+     * @param r Радиус скругления (не больше min(w, h) / 2)
+     */
+    void roundRect(int x, int y, int w, int h, int r, bool color);
+    
+    /**
+     * @brief Нарисовать залитый прямоугольник со скруглёнными углами
+     */
+    void roundRectFill(int x, int y, int w, int h, int r, bool color);
+    
+    /**
+     * @brief Залить многоугольник (таблица рёбер, правило even-odd)
+     *
+     * Колонки обходятся слева направо, пересечения с рёбрами считаются
+     * точно (целочисленный DDA), пары пересечений заливаются вертикальными
+     * span по маскам страниц. Контур line() по тем же вершинам входит в заливку.
+     * Рабочая память - только буфер edges, куча не используется.
+     *
+     * @param points Вершины (не меньше 3), многоугольник замыкается сам
+     * @param edges Буфер рёбер: достаточно count элементов
+     * @param edgeCapacity Размер буфера edges
+     * @return false если вершин меньше 3 или буфера рёбер не хватает (ничего не рисуется)
+     */
+    bool polygonFill(const Point* points, size_t count,
+                     PolygonEdge* edges, size_t edgeCapacity, bool color);
+    
+    /**
+     * @brief Залить треугольник (без таблицы рёбер)
+     *
+     * Тот же результат, что polygonFill() с тремя вершинами.
+     */
+    void triangleFill(int x0, int y0, int x1, int y1, int x2, int y2, bool color);
+    
+    // === Растровые операции ===
+    
+    /**
+     * @brief Наложить битмап в формате страниц (BitBlt)
+     *
+     * Источник в том же формате, что и framebuffer: ceil(h / 8) страниц
+     * по w байт, LSB = верхний пиксель. Обрезается по границам буфера,
+     * при y % 8 != 0 байты источника сдвигаются через две страницы.
+     *
+     * @param x, y Позиция на экране
+     * @param w, h Размер битмапа в пикселях
+     * @param src Данные битмапа
+     * @param op Растровая операция
+     */
+    void blit(int x, int y, int w, int h, const uint8_t* src, RasterOp op = RasterOp::Copy);
+    
+    /**
+     * @brief Наложить битмап, сконвертированный toPageBitmap()
+     */
+    template <uint16_t W, uint16_t H>
+    void blit(int x, int y, const PageBitmap<W, H>& bmp, RasterOp op = RasterOp::Copy) {
+        blit(x, y, W, H, bmp.bits(), op);
+    }
+    
+    /**
+     * @brief Скопировать область framebuffer в другое место
+     *
+     * Области могут перекрываться: порядок обхода выбирается так,
+     * чтобы источник не затирался до чтения.
+     */
+    void copyRect(int srcX, int srcY, int w, int h, int dstX, int dstY,
+                  RasterOp op = RasterOp::Copy);
+
+    /**
+     * @brief Сдвинуть содержимое области на (dx, dy) пикселей
+     *
+     * Данные за пределами области не затрагиваются и не попадают в неё;
+     * открывшиеся полосы заливаются цветом fill. Сдвиг по X - memmove
+     * строк страниц, по Y - склейка соседних страниц 16-битным сдвигом.
+     * Dirty-регион - только сама область.
+     *
+     * @param dx > 0 - вправо, dy > 0 - вниз
+     * @param fill Цвет открывшихся пикселей
+     */
+    void scroll(int x, int y, int w, int h, int dx, int dy, bool fill = false);
+    
     // === Текст ===
     
     /**
@@ -119,20 +331,99 @@ public:
      */
     void setTextColor(bool color);
     
+    /**
+     * @brief Установить пропорциональный шрифт
+     * @param font Шрифт (см. Font.hpp) или nullptr для встроенного 5x7
+     * @note Масштаб setTextSize() применяется только к встроенному шрифту
+     */
+    void setFont(const Font* font);
+    
+    /**
+     * @brief Текущий пропорциональный шрифт (nullptr = встроенный 5x7)
+     */
+    const Font* font() const { return font_; }
+    
     /**
      * @brief Вывести строку (поддержка UTF-8, включая русский)
      */
     void print(const char* str);
     
+    /**
+     * @brief Ширина текста в пикселях текущим шрифтом (без отрисовки)
+     * @return Ширина самой длинной строки (строки разделяются '\n')
+     */
+    int measureText(const char* str) const;
+    
+    /**
+     * @brief Разметить текст текущим шрифтом без отрисовки
+     *
+     * Перенос по границам слов (слово шире maxWidth делится по символам),
+     * '\n' - принудительный перенос. Если текст не помещается в maxLines
+     * строк, последняя строка обрезается по ширине и завершается "...".
+     *
+     * @param layout Результат (перезаписывается)
+     * @param str UTF-8 строка, должна жить, пока используется layout
+     * @param maxWidth Ширина области в пикселях (0 = без переноса)
+     * @param align Выравнивание строк внутри maxWidth
+     * @param maxLines Максимум строк (0 = TextLayout::MAX_LINES)
+     */
+    void layoutText(TextLayout& layout, const char* str, int maxWidth = 0,
+                    TextAlign align = TextAlign::Left, uint8_t maxLines = 0) const;
+    
+    /**
+     * @brief Нарисовать готовую разметку цветом текста
+     * @param x, y Левый верхний угол области разметки
+     * @note Курсор print() не изменяется
+     */
+    void drawText(const TextLayout& layout, int x, int y);
+    
+    /**
+     * @brief Нарисовать строку шрифтом 5x7, повёрнутую на rotation
+     *
+     * Глифы транспонируются (FrameRotate::transpose8x8) и накладываются
+     * как битмапы 8x6: подписи осей и вертикальные метки без поворота
+     * всего кадра. Цвет - цвет текста, масштаб и setFont() не учитываются.
+     *
+     * @param x, y Левый верхний угол первого символа
+     * @param rotation R90 - сверху вниз, R270 - снизу вверх,
+     *                 R180 - справа налево вверх ногами
+     */
+    void drawTextRotated(int x, int y, const char* str, Rotation rotation);
+    
     /**
      * @brief Вывести один ASCII символ
      */
     void drawChar(int x, int y, char c, bool color, uint8_t scale);
     
     /**
-     * @brief Вывести символ по Unicode codepoint (поддержка кириллицы)
+     * @brief Вывести символ по Unicode codepoint (Latin-1, кириллица, греческий,
+     *        псевдографика, иконки - см. GlyphIndex5x7.hpp)
+     */
+    void drawGlyph(int x, int y, uint32_t codepoint, bool color, uint8_t scale);
+    
+protected:
+    /**
+     * @brief Расширить dirty-диапазон страниц (координаты уже обрезаны)
      */
-    void drawGlyph(int x, int y, uint16_t codepoint, bool color, uint8_t scale);
+    void markDirtyClipped(int x0, int x1, int page0, int page1);
+    
+    /**
+     * @brief Физическая страница для логической page из [0, height / 8)
+     */
+    int physPage(int page) const {
+        page += ringOrigin_;
+        return (page >= (height_ >> 3)) ? page - (height_ >> 3) : page;
+    }
+    
+    /**
+     * @brief Отметить один байт (колонка x, физическая страница page в границах)
+     */
+    void markDirtyByte(int x, int page) {
+        // Как markDirtyClipped: страницы за MAX_PAGES не отслеживаются
+        if (page >= MAX_PAGES) return;
+        if (x < dirtyMin_[page]) dirtyMin_[page] = static_cast<uint8_t>(x);
+        if (x > dirtyMax_[page]) dirtyMax_[page] = static_cast<uint8_t>(x);
+    }
     
 private:
     /**
@@ -146,55 +437,301 @@ private:
     void vLine(int x, int y, int h, bool color);
     
     /**
-     * @brief Декодировать UTF-8 символ из строки
+     * @brief Обрезать прямоугольник по границам буфера
+     * @return false если после обрезки ничего не осталось
+     */
+    bool clipRect(int& x, int& y, int& w, int& h) const;
+    
+    /**
+     * @brief Четверти окружности (kQuad* в Gfx.cpp) - для circle() и углов roundRect()
+     */
+    void circleQuadrants(int x0, int y0, int r, uint8_t quadrants, bool color);
+    
+    /**
+     * @brief Левая и/или правая половины круга вертикальными span
+     * @param stretch Дополнительная высота каждой колонки (для roundRectFill)
+     */
+    void circleColumns(int x0, int y0, int r, uint8_t sides, int stretch, bool color);
+    
+    /**
+     * @brief Пологая часть линии (|dx| >= |dy|): шаг по X, пиксель = бит байта
+     * @param count Количество пикселей (> 0), уже внутри экрана
+     * @param rem Ошибка DDA: 0 <= rem < twoMajor
+     */
+    template <int StepY>
+    void lineShallow(int x, int y, int32_t count, int32_t rem, int32_t twoMinor, int32_t twoMajor, bool color);
+    
+    /**
+     * @brief Крутая часть линии (|dy| > |dx|): шаг по Y вниз, биты
+     *        одного байта копятся и пишутся одной записью
+     */
+    template <int StepX>
+    void lineSteep(int x, int y, int32_t count, int32_t rem, int32_t twoMinor, int32_t twoMajor, bool color);
+    
+    /**
+     * @brief Залить колонку между двумя пересечениями с рёбрами
+     */
+    void edgeSpan(int x, const PolygonEdge& a, const PolygonEdge& b, bool color);
+    
+    /**
+     * @brief Span-движок заливки прямоугольника
+     *
+     * Обрезает область один раз, затем пишет целые байты страниц
+     * с масками верхней и нижней страницы. Полная страница = memset.
+     */
+    void fillArea(int x, int y, int w, int h, bool color);
+    
+    /**
+     * @brief Наложить вертикальную колонку бит на буфер
+     *
+     * Бит 0 соответствует строке y. При y % 8 == 0 колонка ложится в байты
+     * страниц напрямую, иначе делится между соседними страницами со сдвигом.
+     *
+     * @param bits Биты колонки (до 32)
+     * @param height Количество значимых бит
+     * @param color true = OR (включить), false = сброс по маске
+     */
+    void blitColumn(int x, int y, uint32_t bits, uint8_t height, bool color);
+    
+    /**
+     * @brief Нарисовать глиф пропорционального шрифта
+     * @param x, y Позиция курсора (верх строки)
+     */
+    void drawFontGlyph(const Font& font, int x, int y, const FontGlyph& glyph, bool color);
+    
+    /**
+     * @brief Граница строки при разметке
+     */
+    struct LineBreak {
+        const char* end;   // Конец содержимого строки
+        const char* next;  // Начало следующей строки
+        int width;         // Ширина содержимого в пикселях
+    };
+    
+    /**
+     * @brief Найти конец строки, начинающейся в str (0 = без ограничения ширины)
+     */
+    LineBreak breakLine(const char* str, int maxWidth) const;
+    
+    /**
+     * @brief Обрезать строку, начинающуюся в str, чтобы с "..." она уместилась в maxWidth
+     */
+    LineBreak ellipsizeLine(const char* str, int maxWidth) const;
+    
+    /**
+     * @brief Нарисовать байты [str, end) шрифтом разметки, вернуть позицию пера
+     */
+    int drawTextRun(const TextLayout& layout, int x, int y, const char* str, const char* end);
+    
+    /**
+     * @brief Нарисовать глиф 5x7 (nullptr - ничего не рисуется)
+     */
+    void drawGlyph5x7(int x, int y, const uint8_t* glyph, bool color, uint8_t scale);
+    
+    /**
+     * @brief Вывести глиф 5x7 в позиции курсора, сдвинуть курсор с автопереносом
+     */
+    void printGlyph5x7(const uint8_t* glyph);
+    
+    /**
+     * @brief Вывести пачку печатных ASCII символов (0x20..0x7F) без декодирования
+     */
+    void printAscii(const char* str, size_t len);
+    
+    /**
+     * @brief Вывести символ текущим пропорциональным шрифтом и сдвинуть курсор
+     */
+    void printFontChar(uint32_t codepoint);
+    
+    /**
+     * @brief Шаг строки текущего шрифта
+     */
+    int lineHeight() const;
+    
+    /**
+     * @brief Декодировать UTF-8 символ из строки (с проверкой по RFC 3629)
      * @param str Указатель на текущую позицию в строке
      * @param codepoint Выходной Unicode codepoint
-     * @return Количество прочитанных байт (1-4), или 0 при ошибке
+     * @return Количество прочитанных байт (1-4), или 0 при ошибке: обрезанная
+     *         последовательность, overlong, суррогаты, codepoint > U+10FFFF
      */
-    static int decodeUtf8(const char* str, uint16_t& codepoint);
+    static int decodeUtf8(const char* str, uint32_t& codepoint);
+    
+    /**
+     * @brief Общее ядро blit/copyRect
+     *
+     * Область назначения [dx, dx + w) x [dy, dy + h) уже обрезана.
+     * Пиксель (dx + i, dy + j) берётся из источника (sx + i, sy + j).
+     */
+    void blitClipped(int dx, int dy, int w, int h, const uint8_t* src, size_t srcStride,
+                     int srcPages, int sx, int sy, RasterOp op);
+    
+    /**
+     * @brief Начало строки логической страницы в буфере
+     */
+    uint8_t* pageRow(int page) {
+        return buffer_ + static_cast<size_t>(physPage(page)) * width_;
+    }
     
     uint8_t* buffer_;
     uint16_t width_;
     uint16_t height_;
+    uint8_t ringOrigin_ = 0;    // Физическая страница логической страницы 0
+    
+    // Dirty-диапазон колонок по страницам (min > max = страница чистая)
+    uint8_t dirtyMin_[MAX_PAGES] = {0};
+    uint8_t dirtyMax_[MAX_PAGES] = {0};
     
     // Состояние текста
     int cursorX_ = 0;
     int cursorY_ = 0;
     uint8_t textScale_ = 1;
     bool textColor_ = true;
+    const Font* font_ = nullptr;
+    const FontGlyph* prevGlyph_ = nullptr;  // Для кернинга
 };
 
+using Gfx = BasicGfx<0, 0>;
+
+/**
+ * @brief Графический контекст фиксированного размера со встроенным буфером
+ *
+ * Размер при компиляции и буфер внутри объекта. Константы использует только
+ * pixel() (и width()/height()/bufferSize()), и только при вызове у
+ * BasicGfx<W, H>: это скрытие, не virtual, через Gfx& работает inline
+ * Gfx::pixel. Остальные примитивы, текст и clear()/fill() - общий код Gfx:
+ * шаг и границы там вынесены из циклов, константный размер выигрывает
+ * не больше 15% (circle, ellipse, print; line/rectFill/blit/scroll - в
+ * пределах 5%), а отдельная копия движка на каждый размер стоит ~23 КБ кода.
+ *
+ * @code
+ * static oled::Gfx128x64 frame;
+ * frame.circleFill(64, 32, 10, true);
+ * display.blit(0, 0, 128, 64, frame.buffer());
+ * @endcode
+ */
+template <uint16_t W, uint16_t H>
+class BasicGfx : public Gfx {
+    static_assert(W > 0 && H > 0 && H % 8 == 0, "BasicGfx: height must be a multiple of 8");
+    static_assert(W <= 256 && H / 8 <= Gfx::MAX_PAGES, "BasicGfx: exceeds dirty-region capacity");
+
+public:
+    static constexpr uint16_t WIDTH = W;
+    static constexpr uint16_t HEIGHT = H;
+    static constexpr size_t BUFFER_SIZE = static_cast<size_t>(W) * H / 8;
+
+    BasicGfx() { Gfx::init(frame_.data(), W, H); }
+
+    // Базовый класс указывает на собственный frame_ - копирование запрещено
+    BasicGfx(const BasicGfx&) = delete;
+    BasicGfx& operator=(const BasicGfx&) = delete;
+
+    static constexpr size_t bufferSize() { return BUFFER_SIZE; }
+    static constexpr uint16_t width() { return W; }
+    static constexpr uint16_t height() { return H; }
+
+    std::array<uint8_t, BUFFER_SIZE>& frame() { return frame_; }
+    const std::array<uint8_t, BUFFER_SIZE>& frame() const { return frame_; }
+
+    void pixel(int x, int y, bool color) {
+        // Беззнаковое сравнение отсекает и отрицательные координаты
+        if (static_cast<unsigned>(x) >= W || static_cast<unsigned>(y) >= H) {
+            return;
+        }
+        const uint8_t mask = static_cast<uint8_t>(1u << (y & 7));
+        int page = (y >> 3) + ringOrigin();
+        if (page >= H / 8) page -= H / 8;
+        uint8_t& byte = frame_[static_cast<size_t>(page) * W + x];
+        byte = color ? static_cast<uint8_t>(byte | mask) : static_cast<uint8_t>(byte & ~mask);
+        markDirtyByte(x, page);
+    }
+
+private:
+    using Gfx::init;   // Буфер и размер заданы типом
+    using Gfx::setBuffer;
+
+    std::array<uint8_t, BUFFER_SIZE> frame_{};
+};
+
+using Gfx128x64 = BasicGfx<128, 64>;
+using Gfx128x32 = BasicGfx<128, 32>;
+
 } // namespace oled
 
 #else // OLED_ENABLED == 0
 
 namespace oled {
 
+template <uint16_t W, uint16_t H>
+class BasicGfx;
+
 // Заглушка
-class Gfx {
+template <>
+class BasicGfx<0, 0> {
 public:
-    Gfx() {}
+    BasicGfx() {}
     void init(uint8_t*, uint16_t, uint16_t) {}
+    void setBuffer(uint8_t*) {}
     bool isInitialized() const { return false; }
     uint8_t* buffer() { return nullptr; }
     const uint8_t* buffer() const { return nullptr; }
     size_t bufferSize() const { return 0; }
     uint16_t width() const { return 0; }
     uint16_t height() const { return 0; }
+    void markDirty(int, int, int, int) {}
+    void markAllDirty() {}
+    void clearDirty() {}
+    bool isDirty() const { return false; }
+    bool pageDirtyRange(uint8_t, uint8_t&, uint8_t&) const { return false; }
+    void setRingOrigin(uint8_t) {}
+    uint8_t ringOrigin() const { return 0; }
     void clear() {}
     void fill(bool) {}
     void pixel(int, int, bool) {}
     void line(int, int, int, int, bool) {}
     void rect(int, int, int, int, bool) {}
     void rectFill(int, int, int, int, bool) {}
+    void circle(int, int, int, bool) {}
+    void circleFill(int, int, int, bool) {}
+    void ellipse(int, int, int, int, bool) {}
+    void ellipseFill(int, int, int, int, bool) {}
+    void arc(int, int, int, int, int, bool) {}
+    void roundRect(int, int, int, int, int, bool) {}
+    void roundRectFill(int, int, int, int, int, bool) {}
+    bool polygonFill(const Point*, size_t, PolygonEdge*, size_t, bool) { return false; }
+    void triangleFill(int, int, int, int, int, int, bool) {}
+    void blit(int, int, int, int, const uint8_t*, RasterOp = RasterOp::Copy) {}
+    template <uint16_t W, uint16_t H>
+    void blit(int, int, const PageBitmap<W, H>&, RasterOp = RasterOp::Copy) {}
+    void copyRect(int, int, int, int, int, int, RasterOp = RasterOp::Copy) {}
+    void scroll(int, int, int, int, int, int, bool = false) {}
     void setCursor(int, int) {}
     void setTextSize(uint8_t) {}
     void setTextColor(bool) {}
+    void setFont(const Font*) {}
+    const Font* font() const { return nullptr; }
     void print(const char*) {}
+    int measureText(const char*) const { return 0; }
+    void layoutText(TextLayout&, const char*, int = 0, TextAlign = TextAlign::Left, uint8_t = 0) const {}
+    void drawText(const TextLayout&, int, int) {}
+    void drawTextRotated(int, int, const char*, Rotation) {}
     void drawChar(int, int, char, bool, uint8_t) {}
-    void drawGlyph(int, int, uint16_t, bool, uint8_t) {}
+    void drawGlyph(int, int, uint32_t, bool, uint8_t) {}
 };
 
+using Gfx = BasicGfx<0, 0>;
+
+template <uint16_t W, uint16_t H>
+class BasicGfx : public Gfx {
+public:
+    static constexpr uint16_t WIDTH = W;
+    static constexpr uint16_t HEIGHT = H;
+    static constexpr size_t BUFFER_SIZE = 0;
+};
+
+using Gfx128x64 = BasicGfx<128, 64>;
+using Gfx128x32 = BasicGfx<128, 32>;
+
 } // namespace oled
 
 #endif // OLED_ENABLED
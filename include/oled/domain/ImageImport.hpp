@@ -0,0 +1,147 @@
+/**
+ * @file ImageImport.hpp
+ * @brief Потоковая загрузка 1bpp изображений: PBM (P1/P4), XBM, BMP
+ *
+ * Файлы хранят пиксели построчно, framebuffer - постранично (см. Gfx.hpp).
+ * Импорт читает по 8 строк, переставляет биты блоками 8x8
+ * (FrameRotate::transpose8x8) и сразу выводит полосу через Gfx::blit().
+ * Рабочая память постоянна и не зависит от размера файла:
+ * буфер чтения 32 байта и полоса 8 строк x OLED_MAX_WIDTH пикселей
+ * (128 байт для 128x64) на стеке.
+ *
+ * Единичный бит файла (чёрный в PBM/BMP, установленный в XBM) -
+ * включённый пиксель. В BMP «чернилами» считается более тёмный цвет палитры.
+ *
+ * Пример - заставка из внешней flash:
+ * @code
+ * struct FlashReader : oled::IByteReader {
+ *     uint32_t addr;
+ *     size_t read(uint8_t* dst, size_t len) override {
+ *         spiFlashRead(addr, dst, len);
+ *         addr += len;
+ *         return len;
+ *     }
+ * };
+ * FlashReader splash{0x10000};
+ * display.drawImage(splash, 0, 0);
+ * @endcode
+ */
+
+#ifndef OLED_IMAGE_IMPORT_HPP
+#define OLED_IMAGE_IMPORT_HPP
+
+#include "../OledConfig.hpp"
+#include "../OledTypes.hpp"
+#include "../ports/IByteReader.hpp"
+#include "Gfx.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace oled {
+
+/**
+ * @brief Формат файла изображения
+ */
+enum class ImageFormat : uint8_t {
+    Unknown,
+    Pbm,    // Netpbm P1 (текст) и P4 (двоичный)
+    Xbm,    // X BitMap (исходник на C)
+    Bmp     // Windows BMP, 1 бит на пиксель, без сжатия
+};
+
+/**
+ * @brief Заголовок изображения
+ */
+struct ImageInfo {
+    uint16_t width = 0;
+    uint16_t height = 0;
+    ImageFormat format = ImageFormat::Unknown;
+};
+
+/**
+ * @brief Чтение из буфера в памяти (RAM или memory-mapped flash)
+ */
+class MemoryReader : public IByteReader {
+public:
+    MemoryReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    size_t read(uint8_t* dst, size_t len) override {
+        const size_t left = size_ - pos_;
+        const size_t n = len < left ? len : left;
+        if (n > 0) {
+            std::memcpy(dst, data_ + pos_, n);
+            pos_ += n;
+        }
+        return n;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+#if OLED_ENABLED
+
+/**
+ * @brief Разбор PBM/XBM/BMP и вывод в Gfx или внеэкранный битмап
+ */
+class ImageImport {
+public:
+    /**
+     * @brief Наибольшая ширина полосы: видимая часть изображения в Gfx
+     * и ширина внеэкранного битмапа
+     */
+    static constexpr uint16_t MAX_STRIP_WIDTH = OLED_MAX_WIDTH;
+
+    /**
+     * @brief Прочитать только заголовок
+     *
+     * Читается с упреждением (до 32 байт): для загрузки пикселей
+     * откройте источник заново.
+     * @return InvalidArg если заголовок повреждён, Unsupported для
+     *         BMP с глубиной цвета больше 1 бита или сжатием
+     */
+    static OledResult readInfo(IByteReader& reader, ImageInfo& info);
+
+    /**
+     * @brief Нарисовать изображение, левый верхний угол в (x, y)
+     *
+     * Части за пределами Gfx отсекаются, их байты пропускаются при чтении.
+     * Видимая часть шире MAX_STRIP_WIDTH обрезается справа.
+     *
+     * @param op Растровая операция (Copy стирает фон под изображением)
+     * @param info Если не nullptr - заголовок изображения
+     * @return InvalidArg если файл повреждён или обрывается
+     *         (уже прочитанные строки остаются нарисованными)
+     */
+    static OledResult draw(IByteReader& reader, Gfx& gfx, int x, int y,
+                           RasterOp op = RasterOp::Copy, ImageInfo* info = nullptr);
+
+    /**
+     * @brief Нарисовать изображение из буфера в памяти
+     */
+    static OledResult draw(const uint8_t* data, size_t size, Gfx& gfx, int x, int y,
+                           RasterOp op = RasterOp::Copy, ImageInfo* info = nullptr) {
+        MemoryReader reader(data, size);
+        return draw(reader, gfx, x, y, op, info);
+    }
+
+    /**
+     * @brief Загрузить изображение во внеэкранный битмап для blit()
+     *
+     * @param dst Буфер ceil(height / 8) страниц по width байт
+     * @param capacity Размер dst в байтах
+     * @param info Размеры загруженного изображения
+     * @return InvalidArg если dst мал, ширина больше MAX_STRIP_WIDTH
+     *         или файл повреждён
+     */
+    static OledResult toBitmap(IByteReader& reader, uint8_t* dst, size_t capacity, ImageInfo& info);
+};
+
+#endif // OLED_ENABLED
+
+} // namespace oled
+
+#endif // OLED_IMAGE_IMPORT_HPP
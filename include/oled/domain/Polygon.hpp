@@ -0,0 +1,50 @@
+/**
+ * @file Polygon.hpp
+ * @brief Вершины и буфер рёбер для заливки многоугольников
+ *
+ * Gfx::polygonFill() не выделяет память: таблица рёбер живёт в буфере,
+ * который передаёт вызывающий. Нужно не больше одного ребра на вершину
+ * (вертикальные рёбра места не занимают).
+ *
+ * Пример - стрелка стрелочного индикатора:
+ * @code
+ * oled::Point needle[] = {{64, 60}, {60, 56}, {64, 20}, {68, 56}};
+ * oled::PolygonEdge edges[4];
+ * display.polygonFill(needle, 4, edges, 4, true);
+ * @endcode
+ */
+
+#ifndef OLED_POLYGON_HPP
+#define OLED_POLYGON_HPP
+
+#include <cstdint>
+
+namespace oled {
+
+/**
+ * @brief Вершина многоугольника
+ */
+struct Point {
+    int16_t x;
+    int16_t y;
+};
+
+/**
+ * @brief Ребро в таблице рёбер (рабочая память polygonFill)
+ *
+ * Пересечение с текущей колонкой хранится точно: y + num / dx,
+ * и сдвигается на следующую колонку целочисленным шагом (DDA).
+ */
+struct PolygonEdge {
+    int16_t xStart;   // Первая колонка ребра (включительно)
+    int16_t xEnd;     // Последняя колонка (не включительно)
+    int32_t y;        // Целая часть пересечения
+    int32_t num;      // Дробная часть: num / dx, 0 <= num < dx
+    int32_t dx;       // Длина ребра по X (> 0)
+    int32_t stepY;    // Целая часть наклона dy / dx
+    int32_t stepNum;  // Остаток наклона: 0 <= stepNum < dx
+};
+
+} // namespace oled
+
+#endif // OLED_POLYGON_HPP
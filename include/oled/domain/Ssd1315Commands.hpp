@@ -53,6 +53,7 @@ constexpr uint8_t SET_MUX_RATIO         = 0xA8; // +1 байт: N-1 (15-63)
 constexpr uint8_t SET_COM_SCAN_INC      = 0xC0; // COM0 -> COM[N-1]
 constexpr uint8_t SET_COM_SCAN_DEC      = 0xC8; // COM[N-1] -> COM0 (flip Y)
 constexpr uint8_t SET_DISPLAY_OFFSET    = 0xD3; // +1 байт: смещение 0-63
+constexpr uint8_t GDDRAM_ROWS           = 64;   // Строк GDDRAM: start line и offset по модулю
 constexpr uint8_t SET_COM_PINS          = 0xDA; // +1 байт: конфигурация COM
 
 // COM Pins Config значения
@@ -71,9 +72,21 @@ constexpr uint8_t SET_CHARGE_PUMP       = 0x8D; // +1 байт: enable/disable
 constexpr uint8_t CHARGE_PUMP_DISABLE   = 0x10;
 constexpr uint8_t CHARGE_PUMP_ENABLE    = 0x14;
 
-// === Scroll Commands (опционально) ===
+// === Scroll Commands ===
+// Непрерывная прокрутка: +6 байт (00h, стр. начала, интервал, стр. конца, кол. начала, кол. конца)
+constexpr uint8_t SCROLL_RIGHT          = 0x26;
+constexpr uint8_t SCROLL_LEFT           = 0x27;
+// Вертикальная + горизонтальная: +7 байт (как 26h/27h, смещение по вертикали перед колонками)
+constexpr uint8_t SCROLL_VERT_RIGHT     = 0x29;
+constexpr uint8_t SCROLL_VERT_LEFT      = 0x2A;
+// Сдвиг содержимого на одну колонку: +6 байт (00h, стр. начала, 01h, стр. конца, колонки)
+constexpr uint8_t CONTENT_SCROLL_RIGHT  = 0x2C;
+constexpr uint8_t CONTENT_SCROLL_LEFT   = 0x2D;
 constexpr uint8_t DEACTIVATE_SCROLL     = 0x2E;
 constexpr uint8_t ACTIVATE_SCROLL       = 0x2F;
+constexpr uint8_t SET_VERT_SCROLL_AREA  = 0xA3; // +2 байта: фиксированных строк, строк прокрутки
+constexpr uint8_t SCROLL_DUMMY          = 0x00; // Байт-заполнитель A команд прокрутки
+constexpr uint8_t CONTENT_SCROLL_DUMMY  = 0x01; // Байт-заполнитель C команд 2Ch/2Dh
 
 // === Timing defaults ===
 constexpr uint8_t DEFAULT_CLOCK_DIV     = 0x80; // Частота по умолчанию
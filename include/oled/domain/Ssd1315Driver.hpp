@@ -10,6 +10,7 @@
 #include "../OledTypes.hpp"
 #include "../OledConfig.hpp"
 #include "Ssd1315Commands.hpp"
+#include <atomic>
 
 #if OLED_ENABLED
 
@@ -23,8 +24,8 @@ namespace oled {
  */
 class Ssd1315Driver {
 public:
-    // Максимальный размер команды (control byte + данные)
-    static constexpr size_t MAX_CMD_SIZE = 8;
+    // Максимальный размер команды (control byte + данные): 29h/2Ah - 8 байт
+    static constexpr size_t MAX_CMD_SIZE = 9;
 
     /**
      * @brief Конструктор по умолчанию (для статического размещения)
@@ -60,6 +61,136 @@ public:
      */
     OledResult setInvert(bool on);
 
+    /**
+     * @brief Установить строку GDDRAM, выводимую первой (SET_START_LINE)
+     *
+     * Изображение сдвигается вверх на line строк по кольцу из 64 строк
+     * GDDRAM - вертикальная прокрутка одной командой, без передачи кадра.
+     *
+     * @param line Строка 0-63
+     * @return InvalidArg если line >= 64
+     */
+    OledResult setStartLine(uint8_t line);
+
+    /**
+     * @brief Установить вертикальное смещение COM (SET_DISPLAY_OFFSET)
+     *
+     * Сдвигает развёртку относительно строк панели; при MUX меньше 64
+     * выбирает видимое окно GDDRAM.
+     *
+     * @param offset Смещение 0-63
+     * @return InvalidArg если offset >= 64
+     */
+    OledResult setDisplayOffset(uint8_t offset);
+
+    /**
+     * @brief Текущая начальная строка
+     */
+    uint8_t startLine() const { return startLine_; }
+
+    /**
+     * @brief Учесть SET_START_LINE, отправленную мимо драйвера (очередь DMA)
+     * @param line Начальная строка 0-63
+     */
+    void noteStartLine(uint8_t line) { startLine_ = line; }
+
+    /**
+     * @brief Текущее смещение COM
+     */
+    uint8_t displayOffset() const { return displayOffset_; }
+
+    /**
+     * @brief Режим page flip для панелей высотой 32 строки
+     *
+     * MUX 32 показывает половину 64 строк GDDRAM, вторая половина скрыта.
+     * В режиме page flip writeBuffer/writeRegion/setAddressWindow пишут
+     * в скрытую половину (страницы буфера сдвигаются на backPage()),
+     * а flip() показывает её одной командой SET_START_LINE.
+     *
+     * @param on true - включить; false - писать снова в страницы 0-3 и
+     *        показывать их (SET_START_LINE 0)
+     * @return Unsupported если высота панели не 32
+     */
+    OledResult setPageFlip(bool on);
+
+    /**
+     * @brief Показать скрытую половину GDDRAM (2 байта по шине)
+     *
+     * Бывшая видимая половина становится скрытой - в неё пойдёт следующий кадр.
+     * @return Unsupported если page flip выключен
+     */
+    OledResult flip();
+
+    /**
+     * @brief Включён ли page flip
+     */
+    bool pageFlip() const { return pageFlip_; }
+
+    /**
+     * @brief Первая страница GDDRAM скрытой половины (0 или 4; 0 без page flip)
+     */
+    uint8_t backPage() const { return backPage_; }
+
+    /**
+     * @brief Запустить непрерывную горизонтальную прокрутку (26h/27h)
+     *
+     * Контроллер сам сдвигает страницы startPage..endPage на колонку
+     * каждые interval кадров, по кольцу на всю ширину. Пока прокрутка
+     * активна, запись в GDDRAM запрещена (setAddressWindow вернёт Busy).
+     *
+     * @return InvalidArg если startPage > endPage или endPage вне экрана
+     */
+    OledResult scrollHorizontal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                ScrollInterval interval);
+
+    /**
+     * @brief Запустить непрерывную диагональную прокрутку (29h/2Ah)
+     *
+     * Как scrollHorizontal, плюс за каждый шаг область
+     * setVerticalScrollArea() сдвигается вверх на verticalOffset строк.
+     *
+     * @param verticalOffset Строк за шаг, 0-63 (0 - только по горизонтали)
+     * @return InvalidArg если страницы вне экрана или verticalOffset >= 64
+     */
+    OledResult scrollDiagonal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                              ScrollInterval interval, uint8_t verticalOffset);
+
+    /**
+     * @brief Задать область вертикальной прокрутки (A3h)
+     *
+     * Сверху fixedRows неподвижных строк, под ними scrollRows прокручиваемых.
+     * После init() - вся высота без фиксированной части.
+     *
+     * @return InvalidArg если fixedRows + scrollRows больше высоты панели
+     */
+    OledResult setVerticalScrollArea(uint8_t fixedRows, uint8_t scrollRows);
+
+    /**
+     * @brief Остановить непрерывную прокрутку (2Eh)
+     *
+     * Содержимое GDDRAM после остановки сдвинуто на неизвестное число шагов:
+     * кадр нужно передать заново.
+     */
+    OledResult stopScroll();
+
+    /**
+     * @brief Сдвинуть окно GDDRAM на одну колонку (2Ch/2Dh)
+     *
+     * Однократный сдвиг без передачи данных: колонка, ушедшая за край окна,
+     * появляется с противоположной стороны. Следующую команду прокрутки
+     * стоит отправлять не раньше чем через 2 кадра.
+     *
+     * @return InvalidArg если окно пустое или вне экрана,
+     *         Busy при активной непрерывной прокрутке
+     */
+    OledResult scrollContent(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                             uint8_t startCol, uint8_t endCol);
+
+    /**
+     * @brief Активна ли непрерывная прокрутка
+     */
+    bool isScrolling() const { return scrolling_; }
+
     /**
      * @brief Записать буфер в GDDRAM
      * @param buffer Указатель на буфер (width * height / 8 байт)
@@ -68,6 +199,69 @@ public:
      */
     OledResult writeBuffer(const uint8_t* buffer, size_t size);
 
+    /**
+     * @brief Записать прямоугольное окно буфера в GDDRAM
+     *
+     * Устанавливает SET_COLUMN_ADDR/SET_PAGE_ADDR на окно и отправляет
+     * только его байты. Окно задаётся включительно.
+     *
+     * @param buffer Полный framebuffer (width * height / 8 байт)
+     * @param colStart Первая колонка
+     * @param colEnd Последняя колонка
+     * @param pageStart Первая страница
+     * @param pageEnd Последняя страница
+     * @return Результат операции
+     */
+    OledResult writeRegion(const uint8_t* buffer, uint8_t colStart, uint8_t colEnd,
+                           uint8_t pageStart, uint8_t pageEnd);
+
+    /**
+     * @brief Установить окно адресации GDDRAM (без передачи данных)
+     * Страницы - страницы буфера: при page flip окно ложится в скрытую половину.
+     * @return Результат операции; Busy при активной непрерывной прокрутке
+     *         или асинхронной передаче
+     */
+    OledResult setAddressWindow(uint8_t colStart, uint8_t colEnd,
+                                uint8_t pageStart, uint8_t pageEnd);
+
+    /**
+     * @brief Начать асинхронную передачу страниц буфера
+     *
+     * Машина состояний через II2c::writeAsync(): окно адресации, затем
+     * данные кусками по OLED_I2C_CHUNK_SIZE, и так для каждой страницы
+     * (подряд идущие страницы на всю ширину - одним окном). Следующий шаг
+     * запускает callback адаптера или poll() - см. setAsyncDrive().
+     * buffer читается по ходу передачи: не меняйте его до завершения.
+     *
+     * @param spans Колонки для каждой из count страниц
+     * @param count Число страниц (не больше height / 8)
+     * @return Ok если передача начата (или уже завершена синхронным адаптером),
+     *         Busy если предыдущая не закончена, I2cError если шаг не начался
+     */
+    OledResult writeSpansAsync(const uint8_t* buffer, const PageSpan* spans, uint8_t count);
+
+    /**
+     * @brief Продвинуть асинхронную передачу (режим AsyncDrive::Poll)
+     * @return Busy пока передача идёт, затем результат последней передачи
+     */
+    OledResult poll();
+
+    /**
+     * @brief Идёт ли асинхронная передача
+     */
+    bool asyncBusy() const { return asyncActive_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Выбрать, кто продвигает асинхронную передачу
+     *
+     * Callback - для адаптеров, которым можно начинать передачу из своего
+     * callback: прерывание того же ядра, что вызывает writeSpansAsync();
+     * poll() тогда не нужен. Poll - callback только отмечает завершение
+     * (release), шаги запускает poll() (acquire): так callback можно
+     * вызывать и из другого потока или задачи RTOS.
+     */
+    void setAsyncDrive(AsyncDrive drive) { asyncDrive_ = drive; }
+
     /**
      * @brief Проверить готовность драйвера
      */
@@ -102,9 +296,40 @@ private:
      */
     bool writeData(const uint8_t* data, size_t len);
 
+    // Асинхронная передача: подготовить следующую транзакцию в txBuf_ (false - всё отправлено)
+    bool prepareAsyncStep(size_t& len);
+    void advanceAsync();
+    void finishAsync(OledResult res);
+    static void onAsyncDone(void* context, bool ok);
+
+    static constexpr uint8_t MAX_PAGES = cmd::GDDRAM_ROWS / 8;
+    static constexpr size_t TX_BUF_SIZE = OLED_I2C_CHUNK_SIZE + 1;
+    static_assert(TX_BUF_SIZE >= 7, "Ssd1315Driver: chunk must fit the window command");
+
     II2c* i2c_;
     OledConfig cfg_;
     bool initialized_ = false;
+    uint8_t startLine_ = 0;
+    uint8_t displayOffset_ = 0;
+    bool scrolling_ = false;
+    bool pageFlip_ = false;
+    uint8_t backPage_ = 0;  // Сдвиг страниц при записи в GDDRAM
+
+    // Асинхронная передача (флаги меняет callback адаптера; только load/store,
+    // без read-modify-write - lock-free и на Cortex-M0)
+    AsyncDrive asyncDrive_ = AsyncDrive::Poll;
+    std::atomic<bool> asyncActive_{false};
+    std::atomic<bool> stepDone_{false};  // Шаг завершён, следующий ещё не начат
+    std::atomic<bool> stepOk_{true};
+    std::atomic<bool> inStep_{false};    // Внутри writeAsync(): callback не продвигает сам
+    OledResult asyncResult_ = OledResult::Ok;
+    const uint8_t* asyncBuf_ = nullptr;
+    PageSpan spans_[MAX_PAGES] = {};
+    uint8_t spanCount_ = 0;
+    uint8_t nextPage_ = 0;
+    const uint8_t* dataPtr_ = nullptr;
+    size_t dataLeft_ = 0;
+    uint8_t txBuf_[TX_BUF_SIZE] = {};  // Живёт до callback шага
 };
 
 } // namespace oled
@@ -121,7 +346,28 @@ public:
     OledResult setPower(bool) { return OledResult::Disabled; }
     OledResult setContrast(uint8_t) { return OledResult::Disabled; }
     OledResult setInvert(bool) { return OledResult::Disabled; }
+    OledResult setStartLine(uint8_t) { return OledResult::Disabled; }
+    OledResult setDisplayOffset(uint8_t) { return OledResult::Disabled; }
+    uint8_t startLine() const { return 0; }
+    void noteStartLine(uint8_t) {}
+    uint8_t displayOffset() const { return 0; }
+    OledResult scrollHorizontal(ScrollDirection, uint8_t, uint8_t, ScrollInterval) { return OledResult::Disabled; }
+    OledResult scrollDiagonal(ScrollDirection, uint8_t, uint8_t, ScrollInterval, uint8_t) { return OledResult::Disabled; }
+    OledResult setVerticalScrollArea(uint8_t, uint8_t) { return OledResult::Disabled; }
+    OledResult stopScroll() { return OledResult::Disabled; }
+    OledResult scrollContent(ScrollDirection, uint8_t, uint8_t, uint8_t, uint8_t) { return OledResult::Disabled; }
+    bool isScrolling() const { return false; }
+    OledResult setPageFlip(bool) { return OledResult::Disabled; }
+    OledResult flip() { return OledResult::Disabled; }
+    bool pageFlip() const { return false; }
+    uint8_t backPage() const { return 0; }
     OledResult writeBuffer(const uint8_t*, size_t) { return OledResult::Disabled; }
+    OledResult writeRegion(const uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t) { return OledResult::Disabled; }
+    OledResult setAddressWindow(uint8_t, uint8_t, uint8_t, uint8_t) { return OledResult::Disabled; }
+    OledResult writeSpansAsync(const uint8_t*, const PageSpan*, uint8_t) { return OledResult::Disabled; }
+    OledResult poll() { return OledResult::Disabled; }
+    bool asyncBusy() const { return false; }
+    void setAsyncDrive(AsyncDrive) {}
     bool isReady() const { return false; }
 };
 
@@ -0,0 +1,88 @@
+/**
+ * @file TextLayout.hpp
+ * @brief Результат разметки текста: строки, ширины, выравнивание
+ *
+ * Gfx::layoutText() один раз декодирует UTF-8, разбивает текст на строки
+ * по границам слов и измеряет их. Готовую разметку можно рисовать
+ * сколько угодно раз через Gfx::drawText() без повторных измерений -
+ * например, центрированные подписи меню.
+ *
+ * Разметка хранит указатель на исходную строку: строка должна жить,
+ * пока используется разметка.
+ *
+ * Пример:
+ * @code
+ * oled::TextLayout label;
+ * display.layoutText(label, "Настройки", 128, oled::TextAlign::Center, 1);
+ * display.drawText(label, 0, 24);
+ * @endcode
+ */
+
+#ifndef OLED_TEXT_LAYOUT_HPP
+#define OLED_TEXT_LAYOUT_HPP
+
+#include "../OledConfig.hpp"
+#include "../OledTypes.hpp"
+#include <cstdint>
+
+namespace oled {
+
+struct Font;
+
+template <uint16_t W, uint16_t H>
+class BasicGfx;
+
+/**
+ * @brief Одна строка разметки
+ */
+struct TextLine {
+    uint16_t start;    // Смещение первого байта строки в исходном тексте
+    uint16_t length;   // Длина строки в байтах (без пробелов на месте переноса)
+    int16_t  x;        // Смещение строки после выравнивания
+    int16_t  width;    // Ширина строки в пикселях (с многоточием)
+};
+
+/**
+ * @brief Разметка текста фиксированной ёмкости (OLED_TEXT_MAX_LINES строк)
+ */
+class TextLayout {
+public:
+    static constexpr uint8_t MAX_LINES = OLED_TEXT_MAX_LINES;
+
+    uint8_t lineCount() const { return lineCount_; }
+    const TextLine& line(uint8_t index) const { return lines_[index]; }
+
+    /**
+     * @brief Шаг строки шрифта, которым сделана разметка
+     */
+    int lineHeight() const { return lineHeight_; }
+
+    /**
+     * @brief Ограничивающий прямоугольник относительно точки drawText()
+     */
+    int left() const { return left_; }
+    int width() const { return width_; }
+    int height() const { return lineCount_ * lineHeight_; }
+
+    /**
+     * @brief Текст не поместился: последняя строка обрезана с многоточием
+     */
+    bool truncated() const { return truncated_; }
+
+private:
+    friend class BasicGfx<0, 0>;   // Gfx
+
+    const char* text_ = nullptr;
+    const Font* font_ = nullptr;
+    uint8_t scale_ = 1;
+    uint8_t lineCount_ = 0;
+    bool truncated_ = false;
+    int16_t lineHeight_ = 0;
+    int16_t left_ = 0;
+    int16_t width_ = 0;
+    TextLine lines_[MAX_LINES] = {};
+};
+
+} // namespace oled
+
+#endif // OLED_TEXT_LAYOUT_HPP
@@ -0,0 +1,37 @@
+/**
+ * @file IByteReader.hpp
+ * @brief Абстракция последовательного источника байт
+ *
+ * Позволяет загружать изображения из внешней flash, SD-карты или файла
+ * без копирования всего файла в RAM
+ */
+
+#ifndef OLED_IBYTE_READER_HPP
+#define OLED_IBYTE_READER_HPP
+
+#include <cstdint>
+#include <cstddef>
+
+namespace oled {
+
+/**
+ * @brief Интерфейс потокового чтения
+ *
+ * Реализуйте этот интерфейс для своего хранилища
+ * или используйте MemoryReader для буфера в памяти (ImageImport.hpp)
+ */
+struct IByteReader {
+    /**
+     * @brief Прочитать следующие байты
+     * @param dst Буфер назначения
+     * @param len Сколько байт запрошено
+     * @return Сколько прочитано (0 - конец данных или ошибка)
+     */
+    virtual size_t read(uint8_t* dst, size_t len) = 0;
+
+    virtual ~IByteReader() = default;
+};
+
+} // namespace oled
+
+#endif // OLED_IBYTE_READER_HPP
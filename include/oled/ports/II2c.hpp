@@ -35,6 +35,37 @@ struct II2c {
      * @return true если устройство отвечает (ACK)
      */
     virtual bool probe(uint8_t addr7) = 0;
+
+    /**
+     * @brief Callback завершения асинхронной записи
+     * @param context Значение, переданное в writeAsync()
+     * @param ok true если передача успешна
+     */
+    using WriteCallback = void (*)(void* context, bool ok);
+
+    /**
+     * @brief Начать запись без ожидания завершения (опционально)
+     *
+     * Адаптер с прерываниями или DMA возвращается сразу и вызывает callback
+     * по окончании (в том числе из ISR). data должен жить до вызова callback.
+     * Реализация по умолчанию - блокирующий write() и callback до возврата,
+     * поэтому асинхронный flush работает с любым адаптером.
+     *
+     * @return false если передачу не удалось начать (callback не вызывается)
+     */
+    virtual bool writeAsync(uint8_t addr7, const uint8_t* data, size_t len,
+                            WriteCallback callback, void* context) {
+        const bool ok = write(addr7, data, len);
+        if (callback) {
+            callback(context, ok);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Идёт ли асинхронная передача (опционально)
+     */
+    virtual bool busy() const { return false; }
     
     virtual ~II2c() = default;
 };
@@ -0,0 +1,293 @@
+#!/usr/bin/env python3
+"""
+Генератор пропорциональных шрифтов OLED SSD1315 из BDF
+
+Создаёт заголовок с oled::Font (см. include/oled/domain/Font.hpp):
+битмапы глифов по колонкам (Packed или Rle), метрики и кернинг.
+
+Использование:
+    python3 scripts/bdf2font.py font.bdf --name FONT_SANS_10 -o FontSans10.hpp
+    python3 scripts/bdf2font.py font.bdf --name FONT_RU --first 0x410 --last 0x44F --encoding rle
+    python3 scripts/bdf2font.py font.bdf --name FONT_UI --kern kern.txt
+
+Файл кернинга: строки "<левый> <правый> <поправка>", символ задаётся
+буквой или как U+XXXX. Пример: "A V -1"
+"""
+
+import argparse
+import sys
+
+MAX_GLYPH_HEIGHT = 32   # Колонка декодируется в uint32_t
+MAX_RUN = 128           # Rle: длина серии в 7 битах (минус 1)
+
+
+def parse_bdf(path):
+    """Прочитать BDF: метрики шрифта и глифы по codepoint."""
+    font = {"ascent": None, "descent": None, "bbox": None, "name": "", "glyphs": {}}
+    glyph = None
+    bitmap_rows = None
+
+    with open(path, "r", encoding="latin-1") as f:
+        for raw in f:
+            line = raw.strip()
+            if not line:
+                continue
+            key, _, rest = line.partition(" ")
+
+            if bitmap_rows is not None:
+                if key == "ENDCHAR":
+                    glyph["rows"] = bitmap_rows
+                    if glyph.get("encoding", -1) >= 0:
+                        font["glyphs"][glyph["encoding"]] = glyph
+                    glyph = None
+                    bitmap_rows = None
+                else:
+                    bitmap_rows.append(line)
+                continue
+
+            if key == "FONT":
+                font["name"] = rest
+            elif key == "FONTBOUNDINGBOX":
+                font["bbox"] = [int(v) for v in rest.split()]
+            elif key == "FONT_ASCENT":
+                font["ascent"] = int(rest)
+            elif key == "FONT_DESCENT":
+                font["descent"] = int(rest)
+            elif key == "STARTCHAR":
+                glyph = {"name": rest}
+            elif glyph is not None and key == "ENCODING":
+                glyph["encoding"] = int(rest.split()[0])
+            elif glyph is not None and key == "DWIDTH":
+                glyph["dwidth"] = int(rest.split()[0])
+            elif glyph is not None and key == "BBX":
+                glyph["bbx"] = [int(v) for v in rest.split()]
+            elif glyph is not None and key == "BITMAP":
+                bitmap_rows = []
+
+    # Метрики по умолчанию из bounding box
+    if font["bbox"] is None:
+        sys.exit("error: FONTBOUNDINGBOX not found")
+    bbw, bbh, bbx, bby = font["bbox"]
+    if font["ascent"] is None:
+        font["ascent"] = bbh + bby
+    if font["descent"] is None:
+        font["descent"] = -bby
+    return font
+
+
+def glyph_pixels(glyph):
+    """Вернуть (w, h, pixel(x, y)) для глифа BDF."""
+    w, h = glyph["bbx"][0], glyph["bbx"][1]
+    rows = []
+    for hexrow in glyph["rows"][:h]:
+        bits = int(hexrow, 16)
+        total = len(hexrow) * 4
+        rows.append([(bits >> (total - 1 - x)) & 1 for x in range(w)])
+    while len(rows) < h:
+        rows.append([0] * w)
+    return w, h, lambda x, y: rows[y][x]
+
+
+def trim(w, h, px):
+    """Обрезать пустые строки сверху и снизу: (top, height)."""
+    used = [y for y in range(h) if any(px(x, y) for x in range(w))]
+    if not used:
+        return 0, 0
+    return used[0], used[-1] - used[0] + 1
+
+
+def column_bits(w, top, h, px):
+    """Поток бит по колонкам: колонка сверху вниз, колонки подряд."""
+    return [px(x, top + y) for x in range(w) for y in range(h)]
+
+
+def pack(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, b in enumerate(bits):
+        if b:
+            out[i // 8] |= 1 << (i % 8)
+    return bytes(out)
+
+
+def rle(bits):
+    out = bytearray()
+    i = 0
+    while i < len(bits):
+        value = bits[i]
+        run = 1
+        while i + run < len(bits) and bits[i + run] == value and run < MAX_RUN:
+            run += 1
+        out.append((0x80 if value else 0x00) | (run - 1))
+        i += run
+    return bytes(out)
+
+
+def parse_char(token):
+    if token.upper().startswith("U+"):
+        return int(token[2:], 16)
+    if len(token) != 1:
+        sys.exit("error: bad kerning character '%s'" % token)
+    return ord(token)
+
+
+def load_kerning(path, first, count):
+    pairs = []
+    with open(path, "r", encoding="utf-8") as f:
+        for line in f:
+            parts = line.split()
+            if not parts or parts[0].startswith("#"):
+                continue
+            left, right, adjust = parse_char(parts[0]), parse_char(parts[1]), int(parts[2])
+            if not (first <= left < first + count and first <= right < first + count):
+                continue
+            if not -128 <= adjust <= 127:
+                sys.exit("error: kerning adjust out of range: %s" % line.strip())
+            pairs.append((left - first, right - first, adjust))
+    return sorted(pairs)
+
+
+def char_comment(cp):
+    if 0x20 < cp < 0x7F and chr(cp) not in "\\'":
+        return "'%s'" % chr(cp)
+    return "U+%04X" % cp
+
+
+def main():
+    parser = argparse.ArgumentParser(description="BDF -> oled::Font header")
+    parser.add_argument("bdf", help="входной BDF файл")
+    parser.add_argument("--name", required=True, help="имя шрифта в C++ (например FONT_SANS_10)")
+    parser.add_argument("--first", type=lambda v: int(v, 0), default=0x20, help="первый codepoint")
+    parser.add_argument("--last", type=lambda v: int(v, 0), default=0x7E, help="последний codepoint")
+    parser.add_argument("--encoding", choices=["packed", "rle", "auto"], default="auto",
+                        help="формат битмапов (auto = меньший из двух)")
+    parser.add_argument("--kern", help="файл пар кернинга")
+    parser.add_argument("-o", "--output", help="выходной .hpp (по умолчанию stdout)")
+    args = parser.parse_args()
+
+    font = parse_bdf(args.bdf)
+    ascent, descent = font["ascent"], font["descent"]
+    count = args.last - args.first + 1
+    if count <= 0 or count > 0xFFFF:
+        sys.exit("error: bad codepoint range")
+
+    # Подготовка глифов: обрезка, поток бит
+    entries = []
+    for cp in range(args.first, args.last + 1):
+        g = font["glyphs"].get(cp)
+        if g is None:
+            entries.append(None)
+            continue
+        w, h, px = glyph_pixels(g)
+        top, height = trim(w, h, px)
+        if height > MAX_GLYPH_HEIGHT:
+            sys.exit("error: glyph %s is taller than %d px" % (char_comment(cp), MAX_GLYPH_HEIGHT))
+        bits = column_bits(w, top, height, px) if height else []
+        bbx, bby = g["bbx"][2], g["bbx"][3]
+        y_offset = ascent - (bby + g["bbx"][1]) + top
+        entries.append({
+            "cp": cp,
+            "width": w if height else 0,
+            "height": height,
+            "advance": g.get("dwidth", w),
+            "x_offset": bbx,
+            "y_offset": y_offset,
+            "bits": bits,
+        })
+
+    encodings = ["packed", "rle"] if args.encoding == "auto" else [args.encoding]
+    best = None
+    for enc in encodings:
+        blob = bytearray()
+        offsets = []
+        for e in entries:
+            offsets.append(len(blob))
+            if e and e["bits"]:
+                blob += pack(e["bits"]) if enc == "packed" else rle(e["bits"])
+        if best is None or len(blob) < len(best[1]):
+            best = (enc, blob, offsets)
+    encoding, blob, offsets = best
+    if len(blob) > 0xFFFF:
+        sys.exit("error: bitmap exceeds 64 KB (uint16_t offsets)")
+
+    for e in entries:
+        if e is None:
+            continue
+        for field in ("advance", "width", "height"):
+            if not 0 <= e[field] <= 255:
+                sys.exit("error: glyph %s %s out of range" % (char_comment(e["cp"]), field))
+        for field in ("x_offset", "y_offset"):
+            if not -128 <= e[field] <= 127:
+                sys.exit("error: glyph %s %s out of range" % (char_comment(e["cp"]), field))
+
+    kerning = load_kerning(args.kern, args.first, count) if args.kern else []
+
+    name = args.name
+    guard = "OLED_%s_HPP" % name.upper()
+    out = []
+    out.append("/**")
+    out.append(" * @file %s" % (args.output.split("/")[-1] if args.output else name + ".hpp"))
+    out.append(" * @brief Шрифт %s (U+%04X - U+%04X)" % (font["name"], args.first, args.last))
+    out.append(" *")
+    out.append(" * Сгенерировано scripts/bdf2font.py - не редактировать вручную.")
+    out.append(" * Формат: %s, битмапы %d байт." % (encoding, len(blob)))
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("#include <oled/domain/Font.hpp>")
+    out.append("")
+    out.append("namespace oled {")
+    out.append("")
+    out.append("constexpr uint8_t %s_BITMAP[] = {" % name)
+    if not blob:
+        out.append("    0x00")
+    for i in range(0, len(blob), 12):
+        out.append("    " + ", ".join("0x%02X" % b for b in blob[i:i + 12]) + ",")
+    out.append("};")
+    out.append("")
+    out.append("constexpr FontGlyph %s_GLYPHS[] = {" % name)
+    out.append("    // offset, width, height, advance, xOffset, yOffset")
+    for e, off in zip(entries, offsets):
+        if e is None:
+            out.append("    {0, 0, 0, 0, 0, 0},")
+            continue
+        out.append("    {%d, %d, %d, %d, %d, %d}, // %s" % (
+            off, e["width"], e["height"], e["advance"], e["x_offset"], e["y_offset"],
+            char_comment(e["cp"])))
+    out.append("};")
+    out.append("")
+    if kerning:
+        out.append("constexpr FontKernPair %s_KERNING[] = {" % name)
+        for left, right, adjust in kerning:
+            out.append("    {%d, %d, %d}, // %s %s" % (
+                left, right, adjust, char_comment(left + args.first),
+                char_comment(right + args.first)))
+        out.append("};")
+        out.append("")
+    out.append("constexpr Font %s = {" % name)
+    out.append("    %s_BITMAP," % name)
+    out.append("    %s_GLYPHS," % name)
+    out.append("    0x%04X, // first" % args.first)
+    out.append("    %d, // glyphCount" % count)
+    out.append("    %d, // lineHeight" % (ascent + descent))
+    out.append("    %d, // baseline" % ascent)
+    out.append("    FontEncoding::%s," % ("Packed" if encoding == "packed" else "Rle"))
+    out.append("    %s," % ("%s_KERNING" % name if kerning else "nullptr"))
+    out.append("    %d // kerningCount" % len(kerning))
+    out.append("};")
+    out.append("")
+    out.append("} // namespace oled")
+    out.append("")
+    out.append("#endif // %s" % guard)
+
+    text = "\n".join(out) + "\n"
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
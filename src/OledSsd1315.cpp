@@ -5,12 +5,14 @@
 
 #include "../include/oled/OledSsd1315.hpp"
 #include "../include/oled/OledSsd1315Impl.hpp"
+#include "../include/oled/domain/ImageImport.hpp"
 
 #if OLED_ENABLED
 
 #include <cstdio>
 #include <cstdarg>
 #include <cstring>
+#include <algorithm>
 
 namespace oled {
 
@@ -18,7 +20,254 @@ namespace {
     // I2C bus recovery constants
     constexpr int kI2cRecoveryClockPulses = 9;      // Макс. кол-во clock pulses для восстановления
     constexpr int kI2cBitBangDelayLoops = 100;      // Циклы задержки для bit-banging (~несколько мкс)
-    constexpr uint8_t kI2cDataCommandPrefix = 0x40; // Префикс команды данных для GDDRAM
+
+#if !OLED_SHADOW_BUFFER
+    // Передать изменённые колонки каждой страницы по dirty-регионам кадра
+    OledResult flushDirty(detail::OledSsd1315Impl& impl, const Gfx& gfx) {
+        const uint8_t pages = static_cast<uint8_t>(gfx.height() / 8);
+        for (uint8_t page = 0; page < pages; ++page) {
+            uint8_t x0 = 0;
+            uint8_t x1 = 0;
+            if (!gfx.pageDirtyRange(page, x0, x1)) {
+                continue;
+            }
+            OledResult res = impl.driver.writeRegion(gfx.buffer(), x0, x1, page, page);
+            if (res != OledResult::Ok) {
+                return res;
+            }
+        }
+        return OledResult::Ok;
+    }
+#else
+    // Передать только байты, отличающиеся от теневой копии GDDRAM
+    // (shadow - копия окна, в которое пишет драйвер: при page flip - скрытой половины)
+    OledResult flushShadow(detail::OledSsd1315Impl& impl, const Gfx& gfx, uint8_t* shadow, bool& valid) {
+        const uint8_t* frame = gfx.buffer();
+
+        // Содержимое GDDRAM неизвестно - отправляем весь кадр
+        if (!valid) {
+            OledResult res = impl.driver.writeBuffer(frame, gfx.bufferSize());
+            if (res == OledResult::Ok) {
+                memcpy(shadow, frame, gfx.bufferSize());
+                valid = true;
+            }
+            return res;
+        }
+
+        const uint16_t width = gfx.width();
+        const uint8_t pages = static_cast<uint8_t>(gfx.height() / 8);
+        DiffRun runs[OLED_DIFF_MAX_RUNS];
+
+        for (uint8_t page = 0; page < pages; ++page) {
+            const size_t rowOffset = static_cast<size_t>(page) * width;
+            size_t count = FrameDiff::diffRow(frame + rowOffset, shadow + rowOffset,
+                                              width, runs, OLED_DIFF_MAX_RUNS);
+            for (size_t i = 0; i < count; ++i) {
+                OledResult res = impl.driver.writeRegion(frame, runs[i].colStart, runs[i].colEnd,
+                                                         page, page);
+                if (res != OledResult::Ok) {
+                    return res;
+                }
+                size_t offset = rowOffset + runs[i].colStart;
+                memcpy(shadow + offset, frame + offset,
+                       static_cast<size_t>(runs[i].colEnd - runs[i].colStart) + 1);
+            }
+        }
+        return OledResult::Ok;
+    }
+#endif
+
+    // Page flip: записать кадр в скрытую половину GDDRAM и показать её
+    OledResult flushPageFlip(detail::OledSsd1315Impl& impl, const Gfx& gfx) {
+        #if OLED_SHADOW_BUFFER
+        const uint8_t half = (impl.driver.backPage() == 0) ? 0x01 : 0x02;
+        bool valid = (impl.shadowHalves & half) != 0;
+        OledResult res = flushShadow(impl, gfx,
+                                     impl.shadow + static_cast<size_t>(impl.driver.backPage()) * gfx.width(),
+                                     valid);
+        if (valid) {
+            impl.shadowHalves |= half;
+        }
+        return (res == OledResult::Ok) ? impl.driver.flip() : res;
+        #else
+        // Скрытая половина содержит позапрошлый кадр: к изменениям этого кадра
+        // добавляются изменения прошлого
+        const uint8_t pages = static_cast<uint8_t>(gfx.height() / 8);
+        for (uint8_t page = 0; page < pages; ++page) {
+            uint8_t x0 = impl.flipDirty[page][0];
+            uint8_t x1 = impl.flipDirty[page][1];
+            uint8_t c0 = 0;
+            uint8_t c1 = 0;
+            if (gfx.pageDirtyRange(page, c0, c1)) {
+                x0 = (x0 <= x1 && x0 < c0) ? x0 : c0;
+                x1 = (x1 > c1) ? x1 : c1;
+            }
+            if (x0 <= x1) {
+                OledResult res = impl.driver.writeRegion(gfx.buffer(), x0, x1, page, page);
+                if (res != OledResult::Ok) {
+                    return res;
+                }
+            }
+        }
+
+        OledResult res = impl.driver.flip();
+        if (res != OledResult::Ok) {
+            return res;
+        }
+        for (uint8_t page = 0; page < pages; ++page) {
+            if (!gfx.pageDirtyRange(page, impl.flipDirty[page][0], impl.flipDirty[page][1])) {
+                impl.flipDirty[page][0] = 0xFF;
+                impl.flipDirty[page][1] = 0;
+            }
+        }
+        return OledResult::Ok;
+        #endif
+    }
+
+    // Отложенная setViewOrigin(): команда уходит вместе с новой страницей кольца
+    OledResult applyViewOrigin(detail::OledSsd1315Impl& impl) {
+        if (!impl.startLinePending) {
+            return OledResult::Ok;
+        }
+        OledResult res = impl.driver.setStartLine(static_cast<uint8_t>(impl.gfx.ringOrigin() * 8));
+        if (res == OledResult::Ok) {
+            impl.startLinePending = false;
+        }
+        return res;
+    }
+
+    // Повторить в кадре сдвиг окна GDDRAM командой 2Ch/2Dh: колонки по кольцу
+    void rotateColumns(uint8_t* frame, uint16_t width, uint8_t startPage, uint8_t endPage,
+                       uint8_t startCol, uint8_t endCol, ScrollDirection dir) {
+        const size_t span = static_cast<size_t>(endCol - startCol);
+        for (uint8_t page = startPage; page <= endPage; ++page) {
+            uint8_t* row = frame + static_cast<size_t>(page) * width + startCol;
+            if (dir == ScrollDirection::Right) {
+                const uint8_t last = row[span];
+                memmove(row + 1, row, span);
+                row[0] = last;
+            } else {
+                const uint8_t first = row[0];
+                memmove(row, row + 1, span);
+                row[span] = first;
+            }
+        }
+    }
+
+    // Gfx кадра в раскладке панели (при повороте 90/270 - impl.panel)
+    Gfx& panelGfx(detail::OledSsd1315Impl& impl) {
+        #if OLED_SOFT_ROTATION
+        if (impl.rotation == Rotation::R90 || impl.rotation == Rotation::R270) {
+            return impl.panel;
+        }
+        #endif
+        return impl.gfx;
+    }
+
+    /**
+     * @brief Кадр в раскладке панели для передачи в GDDRAM
+     *
+     * При повороте 90/270 gfx - логический холст: его изменённые блоки
+     * сначала поворачиваются в impl.panel.
+     */
+    Gfx& panelFrame(detail::OledSsd1315Impl& impl) {
+        #if OLED_SOFT_ROTATION
+        if (impl.rotation == Rotation::R90 || impl.rotation == Rotation::R270) {
+            FrameRotate::rotate(impl.gfx, impl.panel, impl.rotation);
+        }
+        #endif
+        return panelGfx(impl);
+    }
+
+    // Колонки страниц для передачи: dirty-регионы или, с теневой копией, отличия от неё
+    uint8_t collectSpans(detail::OledSsd1315Impl& impl, const Gfx& frame, PageSpan* spans) {
+        const uint8_t pages = static_cast<uint8_t>(frame.height() / 8);
+        for (uint8_t page = 0; page < pages; ++page) {
+            if (!frame.pageDirtyRange(page, spans[page].x0, spans[page].x1)) {
+                spans[page].x0 = 0xFF;
+                spans[page].x1 = 0;
+            }
+        }
+
+        #if OLED_SHADOW_BUFFER
+        // От первого до последнего изменённого байта страницы
+        const uint16_t width = frame.width();
+        for (uint8_t page = 0; page < pages; ++page) {
+            if (!impl.shadowValid) {
+                spans[page].x0 = 0;
+                spans[page].x1 = static_cast<uint8_t>(width - 1);
+                continue;
+            }
+            const size_t rowOffset = static_cast<size_t>(page) * width;
+            DiffRun runs[OLED_DIFF_MAX_RUNS];
+            const size_t count = FrameDiff::diffRow(frame.buffer() + rowOffset, impl.shadow + rowOffset,
+                                                    width, runs, OLED_DIFF_MAX_RUNS);
+            if (count > 0) {
+                spans[page].x0 = runs[0].colStart;
+                spans[page].x1 = runs[count - 1].colEnd;
+            } else {
+                spans[page].x0 = 0xFF;
+                spans[page].x1 = 0;
+            }
+        }
+        #else
+        (void)impl;
+        #endif
+        return pages;
+    }
+
+#if OLED_USE_STM32HAL
+    #if OLED_FRAME_BUFFERS > 1
+    // Обмен слота очереди present() с onDmaComplete(). Без lock-free atomic
+    // (Cortex-M0/M0+: нет LDREX/STREX) - короткая критическая секция
+    int8_t exchangePendingSlot(detail::OledSsd1315Impl& impl, int8_t slot) {
+        #if ATOMIC_CHAR_LOCK_FREE == 2
+        return impl.pendingSlot.exchange(slot);
+        #else
+        const uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        const int8_t prev = impl.pendingSlot;
+        impl.pendingSlot = slot;
+        __set_PRIMASK(primask);
+        return prev;
+        #endif
+    }
+
+    // Кадр заменяет неотправленный: GDDRAM должна получить и колонки заменённого
+    void mergeSpans(PageSpan* into, const PageSpan* from, uint8_t pages) {
+        for (uint8_t page = 0; page < pages; ++page) {
+            if (from[page].x0 > from[page].x1) {
+                continue;
+            }
+            if (into[page].x0 > into[page].x1) {
+                into[page] = from[page];
+                continue;
+            }
+            into[page].x0 = std::min(into[page].x0, from[page].x0);
+            into[page].x1 = std::max(into[page].x1, from[page].x1);
+        }
+    }
+
+    // Окна кадра слота - дескрипторы dmaQueue (present() и цепочка из onDmaComplete())
+    OledResult startSlotDma(detail::OledSsd1315Impl& impl, int8_t slot) {
+        const OledConfig& cfg = impl.driver.config();
+        OledResult res = impl.dmaQueue.build(impl.slots[slot], cfg.width, impl.slotSpans[slot],
+                                             static_cast<uint8_t>(cfg.height / 8), 0,
+                                             impl.slotStartLine[slot]);
+        if (res == OledResult::Ok) {
+            res = impl.dmaQueue.start(impl.adapter, cfg.i2cAddr7);
+        }
+        return res;
+    }
+
+    // Кадр слота не дошёл: его SET_START_LINE могла не дойти - повторить со следующим
+    void restoreStartLine(detail::OledSsd1315Impl& impl, int8_t slot) {
+        if (slot >= 0 && impl.slotStartLine[slot] >= 0) {
+            impl.startLinePending = true;
+        }
+    }
+    #endif
+#endif
 } // anonymous namespace
 
 #if OLED_USE_ARDUINO
@@ -51,6 +300,17 @@ OledResult OledSsd1315::begin(const OledConfig& cfg) {
         return OledResult::InvalidArg;
     }
 
+    // Поворот 90/270: программный, блоки 8x8 по обеим сторонам
+    if (cfg.rotation == Rotation::R90 || cfg.rotation == Rotation::R270) {
+        #if OLED_SOFT_ROTATION
+        if (cfg.width % 8 != 0) {
+            return OledResult::InvalidArg;
+        }
+        #else
+        return OledResult::Unsupported;
+        #endif
+    }
+
     // Инициализируем адаптер I2C (platform-specific)
     #if OLED_USE_ARDUINO
     if (!pImpl_->wire) {
@@ -73,10 +333,39 @@ OledResult OledSsd1315::begin(const OledConfig& cfg) {
     }
 
     // Инициализируем графический контекст
-    pImpl_->gfx.init(pImpl_->buffer, cfg.width, cfg.height);
+    #if OLED_SOFT_ROTATION
+    pImpl_->rotation = cfg.rotation;
+    if (cfg.rotation == Rotation::R90 || cfg.rotation == Rotation::R270) {
+        // Логический холст - портрет, панельный кадр - в исходной раскладке
+        pImpl_->gfx.init(pImpl_->buffer.pixels(), cfg.height, cfg.width);
+        pImpl_->panel.init(pImpl_->panelBuffer.pixels(), cfg.width, cfg.height);
+        pImpl_->panel.clear();
+    } else {
+        pImpl_->gfx.init(pImpl_->buffer.pixels(), cfg.width, cfg.height);
+    }
+    #else
+    pImpl_->gfx.init(pImpl_->buffer.pixels(), cfg.width, cfg.height);
+    #endif
 
     // Очищаем буфер
     pImpl_->gfx.clear();
+    #if OLED_SHADOW_BUFFER
+    pImpl_->shadowValid = false;
+    #endif
+    pImpl_->startLinePending = false;
+
+    #if OLED_USE_STM32HAL && OLED_FRAME_BUFFERS > 1
+    pImpl_->slots[0] = panelGfx(*pImpl_).buffer();
+    for (int i = 1; i < OLED_FRAME_BUFFERS; ++i) {
+        pImpl_->slots[i] = pImpl_->frames[i - 1].pixels();
+    }
+    for (int8_t& line : pImpl_->slotStartLine) {
+        line = -1;
+    }
+    pImpl_->drawSlot = 0;
+    pImpl_->sendSlot = -1;
+    exchangePendingSlot(*pImpl_, -1);
+    #endif
 
     pImpl_->initialized = true;
     pImpl_->lastResult = OledResult::Ok;
@@ -120,6 +409,203 @@ OledResult OledSsd1315::setContrast(uint8_t value) {
     return pImpl_->lastResult;
 }
 
+OledResult OledSsd1315::setStartLine(uint8_t line) {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    pImpl_->lastResult = pImpl_->driver.setStartLine(line);
+    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "setStartLine failed" : nullptr;
+    return pImpl_->lastResult;
+}
+
+OledResult OledSsd1315::setDisplayOffset(uint8_t offset) {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    pImpl_->lastResult = pImpl_->driver.setDisplayOffset(offset);
+    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "setDisplayOffset failed" : nullptr;
+    return pImpl_->lastResult;
+}
+
+OledResult OledSsd1315::setViewOrigin(uint8_t page) {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+
+    // Кольцо буфера совпадает с кольцом GDDRAM только на всю высоту 64 строки;
+    // при повороте 90/270 строки холста - колонки панели
+    bool supported = pImpl_->driver.config().height == cmd::GDDRAM_ROWS;
+    #if OLED_SOFT_ROTATION
+    supported = supported && pImpl_->rotation != Rotation::R90 && pImpl_->rotation != Rotation::R270;
+    #endif
+    if (!supported) {
+        pImpl_->lastResult = OledResult::Unsupported;
+        pImpl_->lastErrorMsg = "setViewOrigin unsupported";
+        return pImpl_->lastResult;
+    }
+
+    pImpl_->gfx.setRingOrigin(page);
+    // Строка, не дошедшая с кадром DMA, остаётся в ожидании, даже если совпадает
+    pImpl_->startLinePending = pImpl_->startLinePending ||
+                               pImpl_->gfx.ringOrigin() * 8 != pImpl_->driver.startLine();
+    pImpl_->lastResult = OledResult::Ok;
+    pImpl_->lastErrorMsg = nullptr;
+    return OledResult::Ok;
+}
+
+uint8_t OledSsd1315::viewOrigin() const {
+    return (pImpl_ && pImpl_->gfx.isInitialized()) ? pImpl_->gfx.ringOrigin() : 0;
+}
+
+OledResult OledSsd1315::setPageFlip(bool on) {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+
+    #if OLED_SHADOW_BUFFER
+    // Теневая копия должна вместить обе половины GDDRAM
+    if (on && 2 * pImpl_->gfx.bufferSize() > OLED_MAX_BUFFER_SIZE) {
+        pImpl_->lastResult = OledResult::Unsupported;
+        pImpl_->lastErrorMsg = "setPageFlip unsupported";
+        return pImpl_->lastResult;
+    }
+    #endif
+
+    pImpl_->lastResult = pImpl_->driver.setPageFlip(on);
+    if (pImpl_->lastResult != OledResult::Ok) {
+        pImpl_->lastErrorMsg = "setPageFlip failed";
+        return pImpl_->lastResult;
+    }
+
+    // Содержимое половин неизвестно: следующие flush() передадут кадр целиком
+    invalidate();
+    pImpl_->lastErrorMsg = nullptr;
+    return OledResult::Ok;
+}
+
+bool OledSsd1315::pageFlip() const {
+    return pImpl_ && pImpl_->driver.pageFlip();
+}
+
+OledResult OledSsd1315::scrollHorizontal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                         ScrollInterval interval) {
+    // GDDRAM должна совпадать с буфером, пока запись в неё запрещена
+    OledResult res = flush();
+    if (res != OledResult::Ok) {
+        return res;
+    }
+    pImpl_->lastResult = pImpl_->driver.scrollHorizontal(dir, startPage, endPage, interval);
+    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "scrollHorizontal failed" : nullptr;
+    return pImpl_->lastResult;
+}
+
+OledResult OledSsd1315::scrollDiagonal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                       ScrollInterval interval, uint8_t verticalOffset) {
+    OledResult res = flush();
+    if (res != OledResult::Ok) {
+        return res;
+    }
+    pImpl_->lastResult = pImpl_->driver.scrollDiagonal(dir, startPage, endPage, interval, verticalOffset);
+    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "scrollDiagonal failed" : nullptr;
+    return pImpl_->lastResult;
+}
+
+OledResult OledSsd1315::setVerticalScrollArea(uint8_t fixedRows, uint8_t scrollRows) {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    pImpl_->lastResult = pImpl_->driver.setVerticalScrollArea(fixedRows, scrollRows);
+    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "setVerticalScrollArea failed" : nullptr;
+    return pImpl_->lastResult;
+}
+
+OledResult OledSsd1315::stopScroll() {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    pImpl_->lastResult = pImpl_->driver.stopScroll();
+    if (pImpl_->lastResult != OledResult::Ok) {
+        pImpl_->lastErrorMsg = "stopScroll failed";
+        return pImpl_->lastResult;
+    }
+
+    // Сдвиг GDDRAM за время прокрутки неизвестен - кадр передаётся заново
+    invalidate();
+    pImpl_->lastErrorMsg = nullptr;
+    return OledResult::Ok;
+}
+
+OledResult OledSsd1315::scrollContent(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                      uint8_t startCol, uint8_t endCol) {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+
+    // Буфер повторяет сдвиг в раскладке панели; при повороте 90/270 это не холст,
+    // при page flip сдвигается видимая половина, а буфер уходит в скрытую
+    bool supported = !pImpl_->driver.pageFlip();
+    #if OLED_SOFT_ROTATION
+    supported = supported && pImpl_->rotation != Rotation::R90 && pImpl_->rotation != Rotation::R270;
+    #endif
+    if (!supported) {
+        pImpl_->lastResult = OledResult::Unsupported;
+        pImpl_->lastErrorMsg = "scrollContent unsupported";
+        return pImpl_->lastResult;
+    }
+
+    // Сдвигается содержимое GDDRAM - сначала оно должно совпасть с буфером
+    OledResult res = flush();
+    if (res != OledResult::Ok) {
+        return res;
+    }
+
+    res = pImpl_->driver.scrollContent(dir, startPage, endPage, startCol, endCol);
+    pImpl_->lastResult = res;
+    if (res != OledResult::Ok) {
+        pImpl_->lastErrorMsg = "scrollContent failed";
+        return res;
+    }
+
+    // GDDRAM уже сдвинута: буфер и теневая копия сдвигаются без пометки dirty
+    Gfx& gfx = pImpl_->gfx;
+    rotateColumns(gfx.buffer(), gfx.width(), startPage, endPage, startCol, endCol, dir);
+    #if OLED_SHADOW_BUFFER
+    if (pImpl_->shadowValid) {
+        rotateColumns(pImpl_->shadow, gfx.width(), startPage, endPage, startCol, endCol, dir);
+    }
+    #endif
+    pImpl_->lastErrorMsg = nullptr;
+    return OledResult::Ok;
+}
+
 OledResult OledSsd1315::invert(bool on) {
     if (!isReady()) {
         if (pImpl_) {
@@ -153,9 +639,260 @@ OledResult OledSsd1315::flush() {
         }
         return OledResult::NotInitialized;
     }
-    pImpl_->lastResult = pImpl_->driver.writeBuffer(pImpl_->gfx.buffer(), pImpl_->gfx.bufferSize());
-    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "flush failed" : nullptr;
-    return pImpl_->lastResult;
+
+    #if OLED_USE_STM32HAL
+    // GDDRAM занята DMA передачей кадра
+    if (pImpl_->dmaInProgress) {
+        pImpl_->lastResult = OledResult::Busy;
+        pImpl_->lastErrorMsg = "DMA transfer in progress";
+        return pImpl_->lastResult;
+    }
+    #endif
+
+    Gfx& frame = panelFrame(*pImpl_);
+    OledResult res = applyViewOrigin(*pImpl_);
+    if (res == OledResult::Ok && pImpl_->driver.pageFlip()) {
+        res = flushPageFlip(*pImpl_, frame);
+    } else if (res == OledResult::Ok) {
+        #if OLED_SHADOW_BUFFER
+        // Сравнение с копией GDDRAM ловит и то, что dirty-регионы пропускают
+        res = flushShadow(*pImpl_, frame, pImpl_->shadow, pImpl_->shadowValid);
+        #else
+        res = flushDirty(*pImpl_, frame);
+        #endif
+    }
+
+    // При ошибке dirty-регионы сохраняются - следующий flush() повторит передачу
+    if (res == OledResult::Ok) {
+        frame.clearDirty();
+        pImpl_->gfx.clearDirty();
+    }
+
+    pImpl_->lastResult = res;
+    pImpl_->lastErrorMsg = (res != OledResult::Ok) ? "flush failed" : nullptr;
+    return res;
+}
+
+OledResult OledSsd1315::present() {
+#if OLED_USE_STM32HAL && OLED_FRAME_BUFFERS > 1
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    detail::OledSsd1315Impl& impl = *pImpl_;
+
+    // Показать скрытую половину можно только после окончания передачи
+    if (impl.driver.pageFlip()) {
+        impl.lastResult = OledResult::Unsupported;
+        impl.lastErrorMsg = "present unsupported with page flip";
+        return impl.lastResult;
+    }
+
+    Gfx& frame = panelFrame(impl);
+    if (!frame.isDirty() && !impl.startLinePending) {
+        impl.lastResult = OledResult::Ok;
+        impl.lastErrorMsg = nullptr;
+        return OledResult::Ok;
+    }
+
+    // Очередь flushDMA() и flushAsync() читают буфер рисования - кадр ставить некуда.
+    // sendSlot читается первым: кадр present() из ничего в onDmaComplete() не стартует
+    const int8_t inFlight = impl.sendSlot;
+    if ((inFlight < 0 && impl.dmaInProgress) || impl.driver.asyncBusy()) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "DMA transfer in progress";
+        return impl.lastResult;
+    }
+
+    // Окна очереди идут мимо setAddressWindow() - её проверку повторяем здесь
+    if (impl.driver.isScrolling()) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "scroll active";
+        return impl.lastResult;
+    }
+
+    // Двум буферам некуда рисовать, пока идёт передача
+    if (OLED_FRAME_BUFFERS < 3 && impl.dmaInProgress) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "DMA transfer in progress";
+        return impl.lastResult;
+    }
+
+    const int8_t draw = static_cast<int8_t>(impl.drawSlot);
+    const uint8_t pages = collectSpans(impl, frame, impl.slotSpans[draw]);
+    impl.slotStartLine[draw] = -1;
+    if (impl.startLinePending) {
+        // Отложенная setViewOrigin() уходит с кадром первым дескриптором очереди.
+        // Сбрасывается до передачи: при ошибке её восстанавливает onDmaError()
+        impl.slotStartLine[draw] = static_cast<int8_t>(impl.gfx.ringOrigin() * 8);
+        impl.driver.noteStartLine(static_cast<uint8_t>(impl.slotStartLine[draw]));
+        impl.startLinePending = false;
+    }
+    bool queued = false;
+    if (impl.dmaInProgress) {
+        // Кадр ждёт onDmaComplete(); ещё не отправленный прошлый кадр отбрасывается,
+        // его окна переходят к новому. Если передача закончилась до обмена, кадр
+        // забирается обратно и шину запускаем сами
+        const int8_t replaced = exchangePendingSlot(impl, -1);
+        if (replaced >= 0) {
+            mergeSpans(impl.slotSpans[draw], impl.slotSpans[replaced], pages);
+            if (impl.slotStartLine[draw] < 0) {
+                impl.slotStartLine[draw] = impl.slotStartLine[replaced];
+            }
+        }
+        exchangePendingSlot(impl, draw);
+        queued = impl.dmaInProgress || exchangePendingSlot(impl, -1) < 0;
+    }
+
+    if (!queued) {
+        impl.sendSlot = draw;
+        impl.dmaInProgress = true;
+        const OledResult res = startSlotDma(impl, draw);
+        impl.dmaInProgress = impl.dmaQueue.active();
+        if (!impl.dmaInProgress) {
+            impl.sendSlot = -1;
+        }
+        if (res != OledResult::Ok) {
+            // Первое окно не ушло: dirty-регионы на месте, present() можно повторить
+            restoreStartLine(impl, draw);
+            impl.lastResult = res;
+            impl.lastErrorMsg = "DMA transfer start failed";
+            return res;
+        }
+    }
+
+    #if OLED_SHADOW_BUFFER
+    // GDDRAM догонит этот кадр, когда очередь опустеет
+    memcpy(impl.shadow, frame.buffer(), frame.bufferSize());
+    impl.shadowValid = true;
+    #endif
+
+    // Свободный слот: не рисуемый и не передаваемый (при обмене в onDmaComplete
+    // передаваемым может стать draw - тогда свободны оба оставшихся)
+    const int8_t sending = impl.sendSlot;
+    uint8_t next = 0;
+    while (static_cast<int8_t>(next) == draw || static_cast<int8_t>(next) == sending) {
+        ++next;
+    }
+
+    // Следующий кадр начинается с копии показанного - рисование остаётся инкрементальным
+    memcpy(impl.slots[next], impl.slots[draw], frame.bufferSize());
+    frame.setBuffer(impl.slots[next]);
+    impl.drawSlot = next;
+    frame.clearDirty();
+    impl.gfx.clearDirty();
+    impl.lastResult = OledResult::Ok;
+    impl.lastErrorMsg = nullptr;
+    return OledResult::Ok;
+#else
+    return flush();
+#endif
+}
+
+OledResult OledSsd1315::flushAsync() {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    detail::OledSsd1315Impl& impl = *pImpl_;
+
+    // Половины GDDRAM переключаются после записи - это делает только flush()
+    if (impl.driver.pageFlip()) {
+        impl.lastResult = OledResult::Unsupported;
+        impl.lastErrorMsg = "flushAsync unsupported with page flip";
+        return impl.lastResult;
+    }
+
+    #if OLED_USE_STM32HAL
+    if (impl.dmaInProgress) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "DMA transfer in progress";
+        return impl.lastResult;
+    }
+    #endif
+
+    if (impl.driver.asyncBusy()) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "async transfer in progress";
+        return impl.lastResult;
+    }
+
+    Gfx& frame = panelFrame(impl);
+    OledResult res = applyViewOrigin(impl);
+    if (res != OledResult::Ok) {
+        impl.lastResult = res;
+        impl.lastErrorMsg = "setStartLine failed";
+        return res;
+    }
+
+    PageSpan spans[cmd::GDDRAM_ROWS / 8];
+    const uint8_t pages = collectSpans(impl, frame, spans);
+    res = impl.driver.writeSpansAsync(frame.buffer(), spans, pages);
+    if (res == OledResult::Ok) {
+        #if OLED_SHADOW_BUFFER
+        // При ошибке передачи poll() сбросит копию
+        memcpy(impl.shadow, frame.buffer(), frame.bufferSize());
+        impl.shadowValid = true;
+        #endif
+        frame.clearDirty();
+        impl.gfx.clearDirty();
+        impl.asyncPending = true;
+    }
+
+    impl.lastResult = res;
+    impl.lastErrorMsg = (res != OledResult::Ok) ? "flushAsync failed" : nullptr;
+    return res;
+}
+
+OledResult OledSsd1315::poll() {
+    if (!isReady()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+
+    OledResult res = pImpl_->driver.poll();
+    if (res == OledResult::Busy) {
+        return res;
+    }
+
+    // Недошедший кадр: GDDRAM неизвестна, следующий flush() отправит всё
+    if (pImpl_->asyncPending && res != OledResult::Ok) {
+        invalidate();
+    }
+    pImpl_->asyncPending = false;
+    pImpl_->lastResult = res;
+    pImpl_->lastErrorMsg = (res != OledResult::Ok) ? "async transfer failed" : nullptr;
+    return res;
+}
+
+void OledSsd1315::setAsyncDrive(AsyncDrive drive) {
+    if (pImpl_) {
+        pImpl_->driver.setAsyncDrive(drive);
+    }
+}
+
+void OledSsd1315::invalidate() {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.markAllDirty();
+        #if OLED_SHADOW_BUFFER
+        pImpl_->shadowValid = false;
+        pImpl_->shadowHalves = 0;
+        #else
+        for (auto& range : pImpl_->flipDirty) {
+            range[0] = 0;
+            range[1] = static_cast<uint8_t>(pImpl_->driver.config().width - 1);
+        }
+        #endif
+    }
 }
 
 void OledSsd1315::pixel(int x, int y, bool color) {
@@ -182,6 +919,92 @@ void OledSsd1315::rectFill(int x, int y, int w, int h, bool color) {
     }
 }
 
+void OledSsd1315::circle(int x0, int y0, int r, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.circle(x0, y0, r, color);
+    }
+}
+
+void OledSsd1315::circleFill(int x0, int y0, int r, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.circleFill(x0, y0, r, color);
+    }
+}
+
+void OledSsd1315::ellipse(int x0, int y0, int rx, int ry, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.ellipse(x0, y0, rx, ry, color);
+    }
+}
+
+void OledSsd1315::ellipseFill(int x0, int y0, int rx, int ry, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.ellipseFill(x0, y0, rx, ry, color);
+    }
+}
+
+void OledSsd1315::arc(int x0, int y0, int r, int startDeg, int endDeg, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.arc(x0, y0, r, startDeg, endDeg, color);
+    }
+}
+
+void OledSsd1315::roundRect(int x, int y, int w, int h, int r, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.roundRect(x, y, w, h, r, color);
+    }
+}
+
+void OledSsd1315::roundRectFill(int x, int y, int w, int h, int r, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.roundRectFill(x, y, w, h, r, color);
+    }
+}
+
+bool OledSsd1315::polygonFill(const Point* points, size_t count,
+                              PolygonEdge* edges, size_t edgeCapacity, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        return pImpl_->gfx.polygonFill(points, count, edges, edgeCapacity, color);
+    }
+    return false;
+}
+
+void OledSsd1315::triangleFill(int x0, int y0, int x1, int y1, int x2, int y2, bool color) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.triangleFill(x0, y0, x1, y1, x2, y2, color);
+    }
+}
+
+void OledSsd1315::blit(int x, int y, int w, int h, const uint8_t* src, RasterOp op) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.blit(x, y, w, h, src, op);
+    }
+}
+
+void OledSsd1315::scroll(int x, int y, int w, int h, int dx, int dy, bool fill) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.scroll(x, y, w, h, dx, dy, fill);
+    }
+}
+
+OledResult OledSsd1315::drawImage(const uint8_t* data, size_t size, int x, int y, RasterOp op) {
+    MemoryReader reader(data, size);
+    return drawImage(reader, x, y, op);
+}
+
+OledResult OledSsd1315::drawImage(IByteReader& reader, int x, int y, RasterOp op) {
+    if (!pImpl_ || !pImpl_->gfx.isInitialized()) {
+        if (pImpl_) {
+            pImpl_->lastResult = OledResult::NotInitialized;
+            pImpl_->lastErrorMsg = "Display not initialized";
+        }
+        return OledResult::NotInitialized;
+    }
+    pImpl_->lastResult = ImageImport::draw(reader, pImpl_->gfx, x, y, op);
+    pImpl_->lastErrorMsg = (pImpl_->lastResult != OledResult::Ok) ? "drawImage failed" : nullptr;
+    return pImpl_->lastResult;
+}
+
 void OledSsd1315::setCursor(int x, int y) {
     if (pImpl_ && pImpl_->gfx.isInitialized()) {
         pImpl_->gfx.setCursor(x, y);
@@ -200,6 +1023,12 @@ void OledSsd1315::setTextColor(bool color) {
     }
 }
 
+void OledSsd1315::setFont(const Font* font) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.setFont(font);
+    }
+}
+
 void OledSsd1315::print(const char* str) {
     if (pImpl_ && pImpl_->gfx.isInitialized()) {
         pImpl_->gfx.print(str);
@@ -218,6 +1047,34 @@ void OledSsd1315::printf(const char* fmt, ...) {
     pImpl_->gfx.print(buf);
 }
 
+int OledSsd1315::measureText(const char* str) const {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        return pImpl_->gfx.measureText(str);
+    }
+    return 0;
+}
+
+void OledSsd1315::layoutText(TextLayout& layout, const char* str, int maxWidth, TextAlign align,
+                             uint8_t maxLines) const {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.layoutText(layout, str, maxWidth, align, maxLines);
+    } else {
+        layout = TextLayout();
+    }
+}
+
+void OledSsd1315::drawText(const TextLayout& layout, int x, int y) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.drawText(layout, x, y);
+    }
+}
+
+void OledSsd1315::drawTextRotated(int x, int y, const char* str, Rotation rotation) {
+    if (pImpl_ && pImpl_->gfx.isInitialized()) {
+        pImpl_->gfx.drawTextRotated(x, y, str, rotation);
+    }
+}
+
 // === Диагностика (Фаза 1) ===
 
 OledResult OledSsd1315::getLastResult() const {
@@ -254,42 +1111,68 @@ OledResult OledSsd1315::flushDMA() {
         }
         return OledResult::NotInitialized;
     }
+    detail::OledSsd1315Impl& impl = *pImpl_;
 
-    if (pImpl_->dmaInProgress) {
-        pImpl_->lastResult = OledResult::Busy;
-        pImpl_->lastErrorMsg = "DMA transfer in progress";
-        return pImpl_->lastResult;
+    if (impl.dmaInProgress || impl.driver.asyncBusy()) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "DMA transfer in progress";
+        return impl.lastResult;
     }
 
-    // Получаем конфигурацию для адреса
-    const OledConfig& cfg = pImpl_->driver.config();
-    uint16_t addr8 = static_cast<uint16_t>(cfg.i2cAddr7) << 1;
+    // Показать скрытую половину можно только после окончания передачи
+    if (impl.driver.pageFlip()) {
+        impl.lastResult = OledResult::Unsupported;
+        impl.lastErrorMsg = "flushDMA unsupported with page flip";
+        return impl.lastResult;
+    }
 
-    // Подготовка буфера с командой данных
-    // Для DMA нужен отдельный буфер с префиксом 0x40
-    static uint8_t dmaBuffer[OLED_MAX_BUFFER_SIZE + 1];
-    dmaBuffer[0] = kI2cDataCommandPrefix;
-    memcpy(dmaBuffer + 1, pImpl_->gfx.buffer(), pImpl_->gfx.bufferSize());
+    // Окна очереди идут мимо setAddressWindow() - её проверку повторяем здесь
+    if (impl.driver.isScrolling()) {
+        impl.lastResult = OledResult::Busy;
+        impl.lastErrorMsg = "scroll active";
+        return impl.lastResult;
+    }
 
-    pImpl_->dmaInProgress = true;
+    Gfx& frame = panelFrame(impl);
+    OledResult res = applyViewOrigin(impl);
+    if (res != OledResult::Ok) {
+        impl.lastResult = res;
+        impl.lastErrorMsg = "setStartLine failed";
+        return res;
+    }
+
+    // Окно и данные каждой изменённой области - дескрипторы одной очереди
+    PageSpan spans[cmd::GDDRAM_ROWS / 8];
+    const uint8_t pages = collectSpans(impl, frame, spans);
+    res = impl.dmaQueue.build(frame.buffer(), frame.width(), spans, pages);
+    if (res != OledResult::Ok) {
+        impl.lastResult = res;
+        impl.lastErrorMsg = "DMA queue build failed";
+        return res;
+    }
 
-    HAL_StatusTypeDef status = HAL_I2C_Master_Transmit_DMA(
-        pImpl_->hi2c,
-        addr8,
-        dmaBuffer,
-        static_cast<uint16_t>(pImpl_->gfx.bufferSize() + 1)
-    );
+    // Снимок и сброс dirty до старта: ошибка из onDmaError() может прийти сразу
+    #if OLED_SHADOW_BUFFER
+    memcpy(impl.shadow, frame.buffer(), frame.bufferSize());
+    impl.shadowValid = true;
+    #endif
+    frame.clearDirty();
+    impl.gfx.clearDirty();
 
-    if (status != HAL_OK) {
-        pImpl_->dmaInProgress = false;
-        pImpl_->lastResult = OledResult::I2cError;
-        pImpl_->lastErrorMsg = "DMA transfer start failed";
-        return pImpl_->lastResult;
+    impl.dmaInProgress = true;
+    res = impl.dmaQueue.start(impl.adapter, impl.driver.config().i2cAddr7);
+    impl.dmaInProgress = impl.dmaQueue.active();
+    if (res != OledResult::Ok) {
+        // Часть окон могла дойти - следующий flush() отправит весь кадр
+        invalidate();
+        impl.lastResult = res;
+        impl.lastErrorMsg = "DMA transfer start failed";
+        return res;
     }
 
-    pImpl_->lastResult = OledResult::Ok;
-    pImpl_->lastErrorMsg = nullptr;
-    return pImpl_->lastResult;
+    impl.lastResult = OledResult::Ok;
+    impl.lastErrorMsg = nullptr;
+    return OledResult::Ok;
 }
 
 bool OledSsd1315::isDMAComplete() const {
@@ -298,8 +1181,65 @@ bool OledSsd1315::isDMAComplete() const {
 
 void OledSsd1315::onDmaComplete() {
     if (pImpl_) {
-        pImpl_->dmaInProgress = false;
+        finishAdapterDma(true);
+    }
+}
+
+void OledSsd1315::onDmaError() {
+    if (pImpl_) {
+        finishAdapterDma(false);
+    }
+}
+
+void OledSsd1315::finishAdapterDma(bool ok) {
+    detail::OledSsd1315Impl& impl = *pImpl_;
+    const bool queueActive = impl.dmaQueue.active();
+    // Callback адаптера сразу запускает следующий дескриптор очереди
+    impl.adapter.onTxComplete(ok);
+    if (!queueActive || impl.dmaQueue.active()) {
+        // Ошибку шага flushAsync() забирает poll()
+        impl.dmaInProgress = impl.dmaQueue.active();
+        return;
+    }
+
+    if (impl.dmaQueue.result() != OledResult::Ok) {
+        // Кадр present()/flushDMA() дошёл не целиком: очередь кадров сбрасывается
+        #if OLED_FRAME_BUFFERS > 1
+        restoreStartLine(impl, exchangePendingSlot(impl, -1));
+        restoreStartLine(impl, impl.sendSlot);
+        impl.sendSlot = -1;
+        #endif
+        impl.dmaInProgress = false;
+        invalidate();
+        impl.lastResult = impl.dmaQueue.result();
+        impl.lastErrorMsg = "DMA transfer failed";
+        return;
+    }
+
+    #if OLED_FRAME_BUFFERS > 1
+    // Кадр из очереди present() уходит сразу, без участия приложения
+    const int8_t next = exchangePendingSlot(impl, -1);
+    if (next >= 0) {
+        impl.sendSlot = next;
+        const OledResult res = startSlotDma(impl, next);
+        if (res == OledResult::Ok && impl.dmaQueue.active()) {
+            return;
+        }
+        if (res != OledResult::Ok) {
+            // Кадр не ушёл, а shadow уже считает его в GDDRAM - следующий кадр целиком
+            restoreStartLine(impl, next);
+            impl.sendSlot = -1;
+            impl.dmaInProgress = false;
+            invalidate();
+            impl.lastResult = OledResult::I2cError;
+            impl.lastErrorMsg = "DMA transfer start failed";
+            return;
+        }
     }
+    // Пустая очередь (кадр без изменений относительно GDDRAM) - шина свободна
+    impl.sendSlot = -1;
+    #endif
+    impl.dmaInProgress = false;
 }
 
 bool OledSsd1315::i2cBusRecovery(void* gpioPort, uint16_t sclPin, uint16_t sdaPin) {
@@ -310,7 +1250,7 @@ bool OledSsd1315::i2cBusRecovery(void* gpioPort, uint16_t sclPin, uint16_t sdaPi
     GPIO_TypeDef* port = static_cast<GPIO_TypeDef*>(gpioPort);
 
     // Сохраняем текущий режим пинов
-    GPIO_InitTypeDef gpio = {0};
+    GPIO_InitTypeDef gpio = {};
     gpio.Mode = GPIO_MODE_OUTPUT_OD;
     gpio.Pull = GPIO_PULLUP;
     gpio.Speed = GPIO_SPEED_FREQ_LOW;
@@ -380,6 +1320,50 @@ OledResult OledSsd1315::setContrast(uint8_t) {
     return OledResult::Disabled;
 }
 
+OledResult OledSsd1315::setStartLine(uint8_t) {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::setDisplayOffset(uint8_t) {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::setViewOrigin(uint8_t) {
+    return OledResult::Disabled;
+}
+
+uint8_t OledSsd1315::viewOrigin() const {
+    return 0;
+}
+
+OledResult OledSsd1315::setPageFlip(bool) {
+    return OledResult::Disabled;
+}
+
+bool OledSsd1315::pageFlip() const {
+    return false;
+}
+
+OledResult OledSsd1315::scrollHorizontal(ScrollDirection, uint8_t, uint8_t, ScrollInterval) {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::scrollDiagonal(ScrollDirection, uint8_t, uint8_t, ScrollInterval, uint8_t) {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::setVerticalScrollArea(uint8_t, uint8_t) {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::stopScroll() {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::scrollContent(ScrollDirection, uint8_t, uint8_t, uint8_t, uint8_t) {
+    return OledResult::Disabled;
+}
+
 OledResult OledSsd1315::invert(bool) {
     return OledResult::Disabled;
 }
@@ -392,6 +1376,22 @@ OledResult OledSsd1315::flush() {
     return OledResult::Disabled;
 }
 
+OledResult OledSsd1315::present() {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::flushAsync() {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::poll() {
+    return OledResult::Disabled;
+}
+
+void OledSsd1315::setAsyncDrive(AsyncDrive) {}
+
+void OledSsd1315::invalidate() {}
+
 void OledSsd1315::pixel(int, int, bool) {}
 
 void OledSsd1315::line(int, int, int, int, bool) {}
@@ -400,16 +1400,58 @@ void OledSsd1315::rect(int, int, int, int, bool) {}
 
 void OledSsd1315::rectFill(int, int, int, int, bool) {}
 
+void OledSsd1315::circle(int, int, int, bool) {}
+
+void OledSsd1315::circleFill(int, int, int, bool) {}
+
+void OledSsd1315::ellipse(int, int, int, int, bool) {}
+
+void OledSsd1315::ellipseFill(int, int, int, int, bool) {}
+
+void OledSsd1315::arc(int, int, int, int, int, bool) {}
+
+void OledSsd1315::roundRect(int, int, int, int, int, bool) {}
+
+void OledSsd1315::roundRectFill(int, int, int, int, int, bool) {}
+
+bool OledSsd1315::polygonFill(const Point*, size_t, PolygonEdge*, size_t, bool) { return false; }
+
+void OledSsd1315::triangleFill(int, int, int, int, int, int, bool) {}
+
+void OledSsd1315::blit(int, int, int, int, const uint8_t*, RasterOp) {}
+
+void OledSsd1315::scroll(int, int, int, int, int, int, bool) {}
+
+OledResult OledSsd1315::drawImage(const uint8_t*, size_t, int, int, RasterOp) {
+    return OledResult::Disabled;
+}
+
+OledResult OledSsd1315::drawImage(IByteReader&, int, int, RasterOp) {
+    return OledResult::Disabled;
+}
+
 void OledSsd1315::setCursor(int, int) {}
 
 void OledSsd1315::setTextSize(uint8_t) {}
 
 void OledSsd1315::setTextColor(bool) {}
 
+void OledSsd1315::setFont(const Font*) {}
+
 void OledSsd1315::print(const char*) {}
 
 void OledSsd1315::printf(const char*, ...) {}
 
+int OledSsd1315::measureText(const char*) const { return 0; }
+
+void OledSsd1315::layoutText(TextLayout& layout, const char*, int, TextAlign, uint8_t) const {
+    layout = TextLayout();
+}
+
+void OledSsd1315::drawText(const TextLayout&, int, int) {}
+
+void OledSsd1315::drawTextRotated(int, int, const char*, Rotation) {}
+
 OledResult OledSsd1315::getLastResult() const {
     return OledResult::Disabled;
 }
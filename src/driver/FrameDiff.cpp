@@ -0,0 +1,65 @@
+/**
+ * @file FrameDiff.cpp
+ * @brief Реализация сравнения кадра с теневой копией GDDRAM
+ */
+
+#include "../../include/oled/domain/FrameDiff.hpp"
+
+#if OLED_ENABLED
+
+#include <cstring>
+
+namespace oled {
+
+size_t FrameDiff::diffRow(const uint8_t* frame, const uint8_t* shadow, uint16_t width,
+                          DiffRun* runs, size_t maxRuns) {
+    if (!frame || !shadow || !runs || maxRuns == 0 || width == 0) {
+        return 0;
+    }
+
+    // Быстрый выход для неизменённой строки
+    if (memcmp(frame, shadow, width) == 0) {
+        return 0;
+    }
+
+    size_t count = 0;
+    uint16_t col = 0;
+
+    while (col < width) {
+        // Пропускаем совпадающие байты
+        while (col < width && frame[col] == shadow[col]) {
+            ++col;
+        }
+        if (col >= width) {
+            break;
+        }
+
+        uint16_t start = col;
+        while (col < width && frame[col] != shadow[col]) {
+            ++col;
+        }
+        uint16_t end = static_cast<uint16_t>(col - 1);
+
+        // Разрыв дешевле нового окна - продолжаем предыдущий run
+        if (count > 0 && static_cast<size_t>(start - runs[count - 1].colEnd - 1) <= RUN_OVERHEAD) {
+            runs[count - 1].colEnd = static_cast<uint8_t>(end);
+            continue;
+        }
+
+        // Нет места - последний run поглощает остаток
+        if (count == maxRuns) {
+            runs[count - 1].colEnd = static_cast<uint8_t>(end);
+            continue;
+        }
+
+        runs[count].colStart = static_cast<uint8_t>(start);
+        runs[count].colEnd = static_cast<uint8_t>(end);
+        ++count;
+    }
+
+    return count;
+}
+
+} // namespace oled
+
+#endif // OLED_ENABLED
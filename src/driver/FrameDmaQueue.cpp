@@ -0,0 +1,132 @@
+/**
+ * @file FrameDmaQueue.cpp
+ * @brief Реализация очереди DMA дескрипторов кадра
+ */
+
+#include "../../include/oled/domain/FrameDmaQueue.hpp"
+
+#if OLED_ENABLED
+
+#include <cstring>
+
+namespace oled {
+
+OledResult FrameDmaQueue::build(const uint8_t* frame, uint16_t width, const PageSpan* spans, uint8_t count,
+                                uint8_t pageOffset, int8_t startLine) {
+    if (active_) {
+        return OledResult::Busy;
+    }
+    if (frame == nullptr || spans == nullptr || count > MAX_WINDOWS || width == 0 ||
+        width > OLED_MAX_WIDTH || startLine >= static_cast<int8_t>(cmd::GDDRAM_ROWS)) {
+        return OledResult::InvalidArg;
+    }
+
+    count_ = 0;
+    next_ = 0;
+    if (startLine >= 0) {
+        // Начальная строка меняется до записи окон кадра, как в flush()
+        startLineCmd_[1] = static_cast<uint8_t>(cmd::SET_START_LINE | startLine);
+        queue_[count_++] = DmaDescriptor{startLineCmd_, sizeof(startLineCmd_), DmaSource::Command};
+    }
+    uint8_t windows = 0;
+    uint8_t page = 0;
+    while (page < count) {
+        const uint8_t x0 = spans[page].x0;
+        const uint8_t x1 = spans[page].x1;
+        if (x0 > x1) {
+            ++page;
+            continue;
+        }
+        if (x1 >= width) {
+            count_ = 0;
+            return OledResult::InvalidArg;
+        }
+
+        // Страницы на всю ширину лежат в кадре подряд - одна передача данных
+        const bool fullWidth = x0 == 0 && x1 == width - 1;
+        uint8_t last = page;
+        while (fullWidth && last + 1 < count &&
+               spans[last + 1].x0 == 0 && spans[last + 1].x1 == width - 1) {
+            ++last;
+        }
+
+        uint8_t* cmdBytes = windowCmds_[windows++];
+        cmdBytes[0] = cmd::CONTROL_COMMAND;
+        cmdBytes[1] = cmd::SET_COLUMN_ADDR;
+        cmdBytes[2] = x0;
+        cmdBytes[3] = x1;
+        cmdBytes[4] = cmd::SET_PAGE_ADDR;
+        cmdBytes[5] = static_cast<uint8_t>(page + pageOffset);
+        cmdBytes[6] = static_cast<uint8_t>(last + pageOffset);
+        queue_[count_++] = DmaDescriptor{cmdBytes, WINDOW_CMD_SIZE, DmaSource::Command};
+
+        const uint16_t cols = static_cast<uint16_t>(x1 - x0 + 1);
+        if (page == 0 && x0 == 0) {
+            // Перед началом кадра - зарезервированный control byte: всё окно одной передачей
+            const uint16_t bytes = static_cast<uint16_t>(cols * (last + 1));
+            queue_[count_++] = DmaDescriptor{frame - 1, static_cast<uint16_t>(bytes + 1), DmaSource::Frame};
+        } else {
+            // Указатель GDDRAM продолжает окно между передачами - строка за строкой
+            for (uint8_t row = page; row <= last; ++row) {
+                const uint8_t* data = frame + static_cast<size_t>(row) * width + x0;
+                queue_[count_++] = DmaDescriptor{data, static_cast<uint16_t>(cols + 1), DmaSource::Staged};
+            }
+        }
+
+        page = static_cast<uint8_t>(last + 1);
+    }
+    return OledResult::Ok;
+}
+
+OledResult FrameDmaQueue::start(II2c& i2c, uint8_t addr7) {
+    if (active_) {
+        return OledResult::Busy;
+    }
+    i2c_ = &i2c;
+    addr7_ = addr7;
+    result_ = OledResult::Ok;
+    if (count_ == 0) {
+        return OledResult::Ok;
+    }
+
+    active_ = true;
+    if (!startNext()) {
+        finish(OledResult::I2cError);
+    }
+    // Синхронный адаптер мог пройти всю очередь внутри startNext()
+    return (active_ || result_ == OledResult::Ok) ? OledResult::Ok : result_;
+}
+
+bool FrameDmaQueue::startNext() {
+    const DmaDescriptor& desc = queue_[next_++];
+    const uint8_t* data = desc.data;
+    if (desc.source == DmaSource::Staged) {
+        memcpy(stage_ + 1, desc.data, desc.len - 1U);
+        data = stage_;
+    }
+    return i2c_->writeAsync(addr7_, data, desc.len, &FrameDmaQueue::onTransferDone, this);
+}
+
+void FrameDmaQueue::finish(OledResult res) {
+    result_ = res;
+    active_ = false;
+}
+
+void FrameDmaQueue::onTransferDone(void* context, bool ok) {
+    FrameDmaQueue* self = static_cast<FrameDmaQueue*>(context);
+    if (!ok) {
+        self->finish(OledResult::I2cError);
+        return;
+    }
+    if (self->next_ >= self->count_) {
+        self->finish(OledResult::Ok);
+        return;
+    }
+    if (!self->startNext()) {
+        self->finish(OledResult::I2cError);
+    }
+}
+
+} // namespace oled
+
+#endif // OLED_ENABLED
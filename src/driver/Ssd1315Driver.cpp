@@ -12,9 +12,20 @@
 namespace oled {
 
 OledResult Ssd1315Driver::init(II2c& i2c, const OledConfig& cfg) {
+    // Машина состояний передачи читает i2c_ и cfg_ - их нельзя менять под ней
+    if (asyncActive_) {
+        return OledResult::Busy;
+    }
+
     i2c_ = &i2c;
     cfg_ = cfg;
     initialized_ = false;
+    startLine_ = 0;
+    displayOffset_ = 0;
+    scrolling_ = false;
+    pageFlip_ = false;
+    backPage_ = 0;
+    asyncResult_ = OledResult::Ok;
 
     // Проверка параметров
     if (cfg_.width == 0 || cfg_.width > 128) {
@@ -72,8 +83,8 @@ OledResult Ssd1315Driver::init(II2c& i2c, const OledConfig& cfg) {
         return OledResult::I2cError;
     }
 
-    // 8. Segment remap и COM scan direction (для flip180)
-    if (cfg_.flip180) {
+    // 8. Segment remap и COM scan direction (flip180 и Rotation::R180 взаимно гасятся)
+    if (cfg_.flip180 != (cfg_.rotation == Rotation::R180)) {
         if (!writeCommand(cmd::SET_SEGMENT_REMAP_0)) return OledResult::I2cError;
         if (!writeCommand(cmd::SET_COM_SCAN_INC)) return OledResult::I2cError;
     } else {
@@ -184,6 +195,169 @@ OledResult Ssd1315Driver::setInvert(bool on) {
     return writeCommand(c) ? OledResult::Ok : OledResult::I2cError;
 }
 
+OledResult Ssd1315Driver::setStartLine(uint8_t line) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (line >= cmd::GDDRAM_ROWS) {
+        return OledResult::InvalidArg;
+    }
+
+    if (!writeCommand(static_cast<uint8_t>(cmd::SET_START_LINE | line))) {
+        return OledResult::I2cError;
+    }
+    startLine_ = line;
+    return OledResult::Ok;
+}
+
+OledResult Ssd1315Driver::setDisplayOffset(uint8_t offset) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (offset >= cmd::GDDRAM_ROWS) {
+        return OledResult::InvalidArg;
+    }
+
+    uint8_t offsetCmd[] = {cmd::SET_DISPLAY_OFFSET, offset};
+    if (!writeCommands(offsetCmd, sizeof(offsetCmd))) {
+        return OledResult::I2cError;
+    }
+    displayOffset_ = offset;
+    return OledResult::Ok;
+}
+
+OledResult Ssd1315Driver::setPageFlip(bool on) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (cfg_.height != cmd::GDDRAM_ROWS / 2) {
+        return OledResult::Unsupported;
+    }
+
+    if (on) {
+        // Скрыта та половина, которую сейчас не показывает SET_START_LINE
+        pageFlip_ = true;
+        backPage_ = (startLine_ < cfg_.height) ? static_cast<uint8_t>(cfg_.height / 8) : 0;
+        return OledResult::Ok;
+    }
+
+    pageFlip_ = false;
+    backPage_ = 0;
+    return (startLine_ != 0) ? setStartLine(0) : OledResult::Ok;
+}
+
+OledResult Ssd1315Driver::flip() {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (!pageFlip_) {
+        return OledResult::Unsupported;
+    }
+
+    OledResult res = setStartLine(static_cast<uint8_t>(backPage_ * 8));
+    if (res == OledResult::Ok) {
+        backPage_ = (backPage_ == 0) ? static_cast<uint8_t>(cfg_.height / 8) : 0;
+    }
+    return res;
+}
+
+OledResult Ssd1315Driver::scrollHorizontal(ScrollDirection dir, uint8_t startPage,
+                                           uint8_t endPage, ScrollInterval interval) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (startPage > endPage || endPage >= cfg_.height / 8) {
+        return OledResult::InvalidArg;
+    }
+
+    // Параметры прокрутки меняются только при остановленной прокрутке
+    if (!writeCommand(cmd::DEACTIVATE_SCROLL)) {
+        return OledResult::I2cError;
+    }
+    scrolling_ = false;
+
+    uint8_t scrollCmd[] = {
+        dir == ScrollDirection::Right ? cmd::SCROLL_RIGHT : cmd::SCROLL_LEFT,
+        cmd::SCROLL_DUMMY, startPage, static_cast<uint8_t>(interval), endPage,
+        0, static_cast<uint8_t>(cfg_.width - 1)
+    };
+    if (!writeCommands(scrollCmd, sizeof(scrollCmd)) || !writeCommand(cmd::ACTIVATE_SCROLL)) {
+        return OledResult::I2cError;
+    }
+    scrolling_ = true;
+    return OledResult::Ok;
+}
+
+OledResult Ssd1315Driver::scrollDiagonal(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                         ScrollInterval interval, uint8_t verticalOffset) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (startPage > endPage || endPage >= cfg_.height / 8 || verticalOffset >= cmd::GDDRAM_ROWS) {
+        return OledResult::InvalidArg;
+    }
+
+    if (!writeCommand(cmd::DEACTIVATE_SCROLL)) {
+        return OledResult::I2cError;
+    }
+    scrolling_ = false;
+
+    uint8_t scrollCmd[] = {
+        dir == ScrollDirection::Right ? cmd::SCROLL_VERT_RIGHT : cmd::SCROLL_VERT_LEFT,
+        cmd::SCROLL_DUMMY, startPage, static_cast<uint8_t>(interval), endPage,
+        verticalOffset, 0, static_cast<uint8_t>(cfg_.width - 1)
+    };
+    if (!writeCommands(scrollCmd, sizeof(scrollCmd)) || !writeCommand(cmd::ACTIVATE_SCROLL)) {
+        return OledResult::I2cError;
+    }
+    scrolling_ = true;
+    return OledResult::Ok;
+}
+
+OledResult Ssd1315Driver::setVerticalScrollArea(uint8_t fixedRows, uint8_t scrollRows) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (fixedRows + scrollRows > cfg_.height) {
+        return OledResult::InvalidArg;
+    }
+
+    uint8_t areaCmd[] = {cmd::SET_VERT_SCROLL_AREA, fixedRows, scrollRows};
+    return writeCommands(areaCmd, sizeof(areaCmd)) ? OledResult::Ok : OledResult::I2cError;
+}
+
+OledResult Ssd1315Driver::stopScroll() {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+
+    if (!writeCommand(cmd::DEACTIVATE_SCROLL)) {
+        return OledResult::I2cError;
+    }
+    scrolling_ = false;
+    return OledResult::Ok;
+}
+
+OledResult Ssd1315Driver::scrollContent(ScrollDirection dir, uint8_t startPage, uint8_t endPage,
+                                        uint8_t startCol, uint8_t endCol) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (startPage > endPage || endPage >= cfg_.height / 8 ||
+        startCol > endCol || endCol >= cfg_.width) {
+        return OledResult::InvalidArg;
+    }
+    if (scrolling_) {
+        return OledResult::Busy;
+    }
+
+    uint8_t scrollCmd[] = {
+        dir == ScrollDirection::Right ? cmd::CONTENT_SCROLL_RIGHT : cmd::CONTENT_SCROLL_LEFT,
+        cmd::SCROLL_DUMMY, startPage, cmd::CONTENT_SCROLL_DUMMY, endPage, startCol, endCol
+    };
+    return writeCommands(scrollCmd, sizeof(scrollCmd)) ? OledResult::Ok : OledResult::I2cError;
+}
+
 OledResult Ssd1315Driver::writeBuffer(const uint8_t* buffer, size_t size) {
     if (!initialized_) {
         return OledResult::NotInitialized;
@@ -198,27 +372,192 @@ OledResult Ssd1315Driver::writeBuffer(const uint8_t* buffer, size_t size) {
         return OledResult::InvalidArg;
     }
 
-    // Установить диапазон колонок (0 - width-1)
-    uint8_t colCmd[] = {cmd::SET_COLUMN_ADDR, 0, static_cast<uint8_t>(cfg_.width - 1)};
-    if (!writeCommands(colCmd, sizeof(colCmd))) {
-        return OledResult::I2cError;
+    uint8_t pages = cfg_.height / 8;
+    return writeRegion(buffer, 0, static_cast<uint8_t>(cfg_.width - 1),
+                       0, static_cast<uint8_t>(pages - 1));
+}
+
+OledResult Ssd1315Driver::writeRegion(const uint8_t* buffer, uint8_t colStart, uint8_t colEnd,
+                                      uint8_t pageStart, uint8_t pageEnd) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
     }
 
-    // Установить диапазон страниц (0 - pages-1)
-    uint8_t pages = cfg_.height / 8;
-    uint8_t pageCmd[] = {cmd::SET_PAGE_ADDR, 0, static_cast<uint8_t>(pages - 1)};
-    if (!writeCommands(pageCmd, sizeof(pageCmd))) {
-        return OledResult::I2cError;
+    if (buffer == nullptr) {
+        return OledResult::InvalidArg;
     }
 
-    // Отправить данные буфера
-    if (!writeData(buffer, size)) {
-        return OledResult::I2cError;
+    OledResult res = setAddressWindow(colStart, colEnd, pageStart, pageEnd);
+    if (res != OledResult::Ok) {
+        return res;
+    }
+
+    // Окно на всю ширину лежит в буфере непрерывно - одна передача
+    const size_t stride = cfg_.width;
+    const size_t cols = static_cast<size_t>(colEnd - colStart) + 1;
+    if (cols == stride) {
+        size_t len = cols * (static_cast<size_t>(pageEnd - pageStart) + 1);
+        return writeData(buffer + pageStart * stride, len) ? OledResult::Ok : OledResult::I2cError;
+    }
+
+    // Иначе по строке страницы: контроллер сам переводит указатель на следующую страницу окна
+    for (uint8_t page = pageStart; page <= pageEnd; ++page) {
+        if (!writeData(buffer + page * stride + colStart, cols)) {
+            return OledResult::I2cError;
+        }
     }
 
     return OledResult::Ok;
 }
 
+OledResult Ssd1315Driver::setAddressWindow(uint8_t colStart, uint8_t colEnd,
+                                           uint8_t pageStart, uint8_t pageEnd) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+
+    uint8_t pages = cfg_.height / 8;
+    if (colStart > colEnd || colEnd >= cfg_.width || pageStart > pageEnd || pageEnd >= pages) {
+        return OledResult::InvalidArg;
+    }
+    if (scrolling_ || asyncActive_) {
+        return OledResult::Busy;  // GDDRAM занята прокруткой или асинхронной передачей
+    }
+
+    // Колонки и страницы одним пакетом: control byte + 6 байт команд
+    uint8_t windowCmd[] = {
+        cmd::SET_COLUMN_ADDR, colStart, colEnd,
+        cmd::SET_PAGE_ADDR, static_cast<uint8_t>(pageStart + backPage_),
+        static_cast<uint8_t>(pageEnd + backPage_)
+    };
+    return writeCommands(windowCmd, sizeof(windowCmd)) ? OledResult::Ok : OledResult::I2cError;
+}
+
+OledResult Ssd1315Driver::writeSpansAsync(const uint8_t* buffer, const PageSpan* spans, uint8_t count) {
+    if (!initialized_) {
+        return OledResult::NotInitialized;
+    }
+    if (buffer == nullptr || spans == nullptr || count > cfg_.height / 8) {
+        return OledResult::InvalidArg;
+    }
+    for (uint8_t page = 0; page < count; ++page) {
+        if (spans[page].x0 <= spans[page].x1 && spans[page].x1 >= cfg_.width) {
+            return OledResult::InvalidArg;
+        }
+    }
+    if (scrolling_ || asyncActive_) {
+        return OledResult::Busy;
+    }
+
+    memcpy(spans_, spans, count * sizeof(PageSpan));
+    spanCount_ = count;
+    nextPage_ = 0;
+    asyncBuf_ = buffer;
+    dataLeft_ = 0;
+    stepOk_.store(true, std::memory_order_relaxed);
+    asyncActive_.store(true, std::memory_order_release);
+    advanceAsync();
+
+    // Синхронный адаптер мог пройти всю передачу внутри advanceAsync()
+    return (asyncBusy() || asyncResult_ == OledResult::Ok) ? OledResult::Ok : asyncResult_;
+}
+
+OledResult Ssd1315Driver::poll() {
+    // acquire: stepOk_ и байты шага, записанные до завершения, видны здесь
+    if (asyncBusy() && asyncDrive_ == AsyncDrive::Poll && stepDone_.load(std::memory_order_acquire)) {
+        advanceAsync();
+    }
+    return asyncBusy() ? OledResult::Busy : asyncResult_;
+}
+
+bool Ssd1315Driver::prepareAsyncStep(size_t& len) {
+    if (dataLeft_ == 0) {
+        // Следующее окно: страница с изменениями, на всю ширину - вместе с соседними
+        while (nextPage_ < spanCount_ && spans_[nextPage_].x0 > spans_[nextPage_].x1) {
+            ++nextPage_;
+        }
+        if (nextPage_ >= spanCount_) {
+            return false;
+        }
+
+        const uint8_t first = nextPage_;
+        const uint8_t x0 = spans_[first].x0;
+        const uint8_t x1 = spans_[first].x1;
+        const bool fullWidth = x0 == 0 && x1 == cfg_.width - 1;
+        uint8_t last = first;
+        while (fullWidth && last + 1 < spanCount_ &&
+               spans_[last + 1].x0 == 0 && spans_[last + 1].x1 == cfg_.width - 1) {
+            ++last;
+        }
+        nextPage_ = static_cast<uint8_t>(last + 1);
+
+        dataPtr_ = asyncBuf_ + static_cast<size_t>(first) * cfg_.width + x0;
+        dataLeft_ = static_cast<size_t>(x1 - x0 + 1) * (last - first + 1);
+
+        const uint8_t windowCmd[] = {
+            cmd::CONTROL_COMMAND,
+            cmd::SET_COLUMN_ADDR, x0, x1,
+            cmd::SET_PAGE_ADDR, static_cast<uint8_t>(first + backPage_),
+            static_cast<uint8_t>(last + backPage_)
+        };
+        memcpy(txBuf_, windowCmd, sizeof(windowCmd));
+        len = sizeof(windowCmd);
+        return true;
+    }
+
+    const size_t chunkLen = (dataLeft_ > OLED_I2C_CHUNK_SIZE) ? OLED_I2C_CHUNK_SIZE : dataLeft_;
+    txBuf_[0] = cmd::CONTROL_DATA;
+    memcpy(txBuf_ + 1, dataPtr_, chunkLen);
+    dataPtr_ += chunkLen;
+    dataLeft_ -= chunkLen;
+    len = chunkLen + 1;
+    return true;
+}
+
+void Ssd1315Driver::advanceAsync() {
+    // Синхронные завершения обрабатываются циклом, а не рекурсией из callback
+    for (;;) {
+        if (!stepOk_.load(std::memory_order_relaxed)) {
+            finishAsync(OledResult::I2cError);
+            return;
+        }
+        size_t len = 0;
+        if (!prepareAsyncStep(len)) {
+            finishAsync(OledResult::Ok);
+            return;
+        }
+
+        stepDone_.store(false, std::memory_order_relaxed);
+        inStep_.store(true, std::memory_order_relaxed);
+        const bool started = i2c_->writeAsync(cfg_.i2cAddr7, txBuf_, len, &Ssd1315Driver::onAsyncDone, this);
+        inStep_.store(false, std::memory_order_relaxed);
+        if (!started) {
+            finishAsync(OledResult::I2cError);
+            return;
+        }
+        // Завершения ещё не было: следующий шаг запустит callback или poll()
+        if (!stepDone_.load(std::memory_order_acquire)) {
+            return;
+        }
+    }
+}
+
+void Ssd1315Driver::finishAsync(OledResult res) {
+    asyncResult_ = res;
+    stepDone_.store(false, std::memory_order_relaxed);
+    asyncActive_.store(false, std::memory_order_release);
+}
+
+void Ssd1315Driver::onAsyncDone(void* context, bool ok) {
+    Ssd1315Driver* self = static_cast<Ssd1315Driver*>(context);
+    self->stepOk_.store(ok, std::memory_order_relaxed);
+    if (self->asyncDrive_ == AsyncDrive::Callback && !self->inStep_.load(std::memory_order_relaxed)) {
+        self->advanceAsync();
+    } else {
+        self->stepDone_.store(true, std::memory_order_release);
+    }
+}
+
 bool Ssd1315Driver::writeCommand(uint8_t c) {
     uint8_t buf[2] = {cmd::CONTROL_COMMAND, c};
     return i2c_->write(cfg_.i2cAddr7, buf, 2);
@@ -161,31 +161,6 @@ constexpr uint8_t FONT_CYRILLIC_YO_LOWER[] = {
     0x38, 0x55, 0x54, 0x55, 0x18,
 };
 
-/**
- * @brief Получить глиф для кириллического символа
- * @param codepoint Unicode codepoint (U+0410-U+044F, U+0401, U+0451)
- * @return Указатель на 5-байтовый массив глифа или nullptr
- */
-inline const uint8_t* getCyrillicGlyph(uint16_t codepoint) {
-    // Ё
-    if (codepoint == 0x0401) {
-        return FONT_CYRILLIC_YO_UPPER;
-    }
-    // ё
-    if (codepoint == 0x0451) {
-        return FONT_CYRILLIC_YO_LOWER;
-    }
-    // А-Я (U+0410 - U+042F)
-    if (codepoint >= 0x0410 && codepoint <= 0x042F) {
-        return &FONT_CYRILLIC_UPPER[(codepoint - 0x0410) * 5];
-    }
-    // а-я (U+0430 - U+044F)
-    if (codepoint >= 0x0430 && codepoint <= 0x044F) {
-        return &FONT_CYRILLIC_LOWER[(codepoint - 0x0430) * 5];
-    }
-    return nullptr;
-}
-
 } // namespace oled
 
 #endif // OLED_FONT_CYRILLIC_5X7_HPP
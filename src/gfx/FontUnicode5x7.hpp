@@ -0,0 +1,432 @@
+/**
+ * @file FontUnicode5x7.hpp
+ * @brief Дополнительные блоки Unicode для шрифта 5x7
+ * 
+ * Latin-1, украинские и белорусские буквы, греческий, псевдографика и иконки.
+ * Формат совпадает с Font5x7: 5 байт на символ (колонки, биты снизу вверх).
+ * Поиск глифа по codepoint - таблица диапазонов в GlyphIndex5x7.hpp.
+ */
+
+#ifndef OLED_FONT_UNICODE_5X7_HPP
+#define OLED_FONT_UNICODE_5X7_HPP
+
+#include <cstdint>
+
+namespace oled {
+
+// Latin-1 Supplement (U+00A0 - U+00FF)
+// Каждый символ - 5 байт (колонки), биты снизу вверх
+constexpr uint8_t FONT_LATIN1_SUPPLEMENT[] = {
+    // NBSP (U+00A0)
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // ¡ (U+00A1)
+    0x00, 0x00, 0x7D, 0x00, 0x00,
+    // ¢ (U+00A2)
+    0x0C, 0x12, 0x3F, 0x12, 0x12,
+    // £ (U+00A3)
+    0x48, 0x3E, 0x49, 0x41, 0x22,
+    // ¤ (U+00A4)
+    0x22, 0x1C, 0x14, 0x1C, 0x22,
+    // ¥ (U+00A5)
+    0x15, 0x16, 0x7C, 0x16, 0x15,
+    // ¦ (U+00A6)
+    0x00, 0x00, 0x77, 0x00, 0x00,
+    // § (U+00A7)
+    0x4A, 0x55, 0x55, 0x29, 0x00,
+    // ¨ (U+00A8)
+    0x00, 0x01, 0x00, 0x01, 0x00,
+    // © (U+00A9)
+    0x3E, 0x5D, 0x55, 0x41, 0x3E,
+    // ª (U+00AA)
+    0x48, 0x55, 0x55, 0x5E, 0x00,
+    // « (U+00AB)
+    0x08, 0x14, 0x2A, 0x14, 0x22,
+    // ¬ (U+00AC)
+    0x04, 0x04, 0x04, 0x04, 0x1C,
+    // SHY (U+00AD)
+    0x08, 0x08, 0x08, 0x08, 0x08,
+    // ® (U+00AE)
+    0x3E, 0x5D, 0x4D, 0x51, 0x3E,
+    // ¯ (U+00AF)
+    0x01, 0x01, 0x01, 0x01, 0x01,
+    // ° (U+00B0)
+    0x06, 0x09, 0x09, 0x06, 0x00,
+    // ± (U+00B1)
+    0x44, 0x44, 0x5F, 0x44, 0x44,
+    // ² (U+00B2)
+    0x09, 0x0D, 0x0A, 0x00, 0x00,
+    // ³ (U+00B3)
+    0x11, 0x15, 0x1F, 0x00, 0x00,
+    // ´ (U+00B4)
+    0x00, 0x00, 0x02, 0x01, 0x00,
+    // µ (U+00B5)
+    0x7C, 0x20, 0x20, 0x1C, 0x20,
+    // ¶ (U+00B6)
+    0x06, 0x0F, 0x7F, 0x01, 0x7F,
+    // · (U+00B7)
+    0x00, 0x00, 0x08, 0x00, 0x00,
+    // ¸ (U+00B8)
+    0x00, 0x40, 0x60, 0x00, 0x00,
+    // ¹ (U+00B9)
+    0x12, 0x1F, 0x10, 0x00, 0x00,
+    // º (U+00BA)
+    0x26, 0x29, 0x29, 0x26, 0x00,
+    // » (U+00BB)
+    0x22, 0x14, 0x2A, 0x14, 0x08,
+    // ¼ (U+00BC)
+    0x17, 0x08, 0x34, 0x7A, 0x20,
+    // ½ (U+00BD)
+    0x17, 0x08, 0x4C, 0x6A, 0x50,
+    // ¾ (U+00BE)
+    0x15, 0x0F, 0x34, 0x7A, 0x20,
+    // ¿ (U+00BF)
+    0x30, 0x48, 0x45, 0x40, 0x20,
+    // À (U+00C0)
+    0x7C, 0x13, 0x12, 0x12, 0x7C,
+    // Á (U+00C1)
+    0x7C, 0x12, 0x12, 0x13, 0x7C,
+    // Â (U+00C2)
+    0x7C, 0x12, 0x13, 0x12, 0x7C,
+    // Ã (U+00C3)
+    0x7C, 0x13, 0x13, 0x12, 0x7D,
+    // Ä (U+00C4)
+    0x7C, 0x13, 0x12, 0x13, 0x7C,
+    // Å (U+00C5)
+    0x70, 0x2A, 0x25, 0x2A, 0x70,
+    // Æ (U+00C6)
+    0x7E, 0x09, 0x7F, 0x49, 0x41,
+    // Ç (U+00C7)
+    0x1E, 0x61, 0x61, 0x21, 0x12,
+    // È (U+00C8)
+    0x7E, 0x53, 0x52, 0x52, 0x42,
+    // É (U+00C9)
+    0x7E, 0x52, 0x52, 0x53, 0x42,
+    // Ê (U+00CA)
+    0x7E, 0x52, 0x53, 0x52, 0x42,
+    // Ë (U+00CB)
+    0x7E, 0x53, 0x52, 0x53, 0x42,
+    // Ì (U+00CC)
+    0x00, 0x43, 0x7E, 0x42, 0x00,
+    // Í (U+00CD)
+    0x00, 0x42, 0x7E, 0x43, 0x00,
+    // Î (U+00CE)
+    0x00, 0x42, 0x7F, 0x42, 0x00,
+    // Ï (U+00CF)
+    0x00, 0x43, 0x7E, 0x43, 0x00,
+    // Ð (U+00D0)
+    0x7F, 0x49, 0x49, 0x22, 0x1C,
+    // Ñ (U+00D1)
+    0x7E, 0x09, 0x11, 0x20, 0x7F,
+    // Ò (U+00D2)
+    0x3C, 0x43, 0x42, 0x42, 0x3C,
+    // Ó (U+00D3)
+    0x3C, 0x42, 0x42, 0x43, 0x3C,
+    // Ô (U+00D4)
+    0x3C, 0x42, 0x43, 0x42, 0x3C,
+    // Õ (U+00D5)
+    0x3C, 0x43, 0x43, 0x42, 0x3D,
+    // Ö (U+00D6)
+    0x3C, 0x43, 0x42, 0x43, 0x3C,
+    // × (U+00D7)
+    0x22, 0x14, 0x08, 0x14, 0x22,
+    // Ø (U+00D8)
+    0x3E, 0x61, 0x5D, 0x43, 0x3E,
+    // Ù (U+00D9)
+    0x3E, 0x41, 0x40, 0x40, 0x3E,
+    // Ú (U+00DA)
+    0x3E, 0x40, 0x40, 0x41, 0x3E,
+    // Û (U+00DB)
+    0x3E, 0x40, 0x41, 0x40, 0x3E,
+    // Ü (U+00DC)
+    0x3E, 0x41, 0x40, 0x41, 0x3E,
+    // Ý (U+00DD)
+    0x06, 0x08, 0x70, 0x09, 0x06,
+    // Þ (U+00DE)
+    0x7F, 0x12, 0x12, 0x12, 0x0C,
+    // ß (U+00DF)
+    0x7E, 0x01, 0x49, 0x56, 0x20,
+    // à (U+00E0)
+    0x20, 0x55, 0x56, 0x54, 0x78,
+    // á (U+00E1)
+    0x20, 0x54, 0x56, 0x55, 0x78,
+    // â (U+00E2)
+    0x20, 0x56, 0x55, 0x56, 0x78,
+    // ã (U+00E3)
+    0x22, 0x55, 0x55, 0x56, 0x79,
+    // ä (U+00E4)
+    0x20, 0x55, 0x54, 0x55, 0x78,
+    // å (U+00E5)
+    0x20, 0x57, 0x55, 0x57, 0x78,
+    // æ (U+00E6)
+    0x24, 0x54, 0x38, 0x54, 0x58,
+    // ç (U+00E7)
+    0x18, 0x24, 0x64, 0x24, 0x10,
+    // è (U+00E8)
+    0x38, 0x55, 0x56, 0x54, 0x18,
+    // é (U+00E9)
+    0x38, 0x54, 0x56, 0x55, 0x18,
+    // ê (U+00EA)
+    0x38, 0x56, 0x55, 0x56, 0x18,
+    // ë (U+00EB)
+    0x38, 0x55, 0x54, 0x55, 0x18,
+    // ì (U+00EC)
+    0x00, 0x45, 0x7E, 0x40, 0x00,
+    // í (U+00ED)
+    0x00, 0x44, 0x7E, 0x41, 0x00,
+    // î (U+00EE)
+    0x00, 0x46, 0x7D, 0x42, 0x00,
+    // ï (U+00EF)
+    0x00, 0x45, 0x7C, 0x41, 0x00,
+    // ð (U+00F0)
+    0x20, 0x55, 0x52, 0x55, 0x38,
+    // ñ (U+00F1)
+    0x7E, 0x09, 0x05, 0x06, 0x79,
+    // ò (U+00F2)
+    0x38, 0x45, 0x46, 0x44, 0x38,
+    // ó (U+00F3)
+    0x38, 0x44, 0x46, 0x45, 0x38,
+    // ô (U+00F4)
+    0x38, 0x46, 0x45, 0x46, 0x38,
+    // õ (U+00F5)
+    0x3A, 0x45, 0x45, 0x46, 0x39,
+    // ö (U+00F6)
+    0x38, 0x45, 0x44, 0x45, 0x38,
+    // ÷ (U+00F7)
+    0x08, 0x08, 0x2A, 0x08, 0x08,
+    // ø (U+00F8)
+    0x38, 0x64, 0x54, 0x4C, 0x38,
+    // ù (U+00F9)
+    0x3C, 0x41, 0x42, 0x20, 0x7C,
+    // ú (U+00FA)
+    0x3C, 0x40, 0x42, 0x21, 0x7C,
+    // û (U+00FB)
+    0x3C, 0x42, 0x41, 0x22, 0x7C,
+    // ü (U+00FC)
+    0x3C, 0x41, 0x40, 0x21, 0x7C,
+    // ý (U+00FD)
+    0x0C, 0x50, 0x52, 0x51, 0x3C,
+    // þ (U+00FE)
+    0x7F, 0x24, 0x24, 0x18, 0x00,
+    // ÿ (U+00FF)
+    0x0C, 0x51, 0x50, 0x51, 0x3C,
+};
+
+// Украинские и белорусские буквы: Є І Ї Ў є і ї ў Ґ ґ
+constexpr uint8_t FONT_CYRILLIC_EXT[] = {
+    // Є (U+0404)
+    0x3E, 0x49, 0x49, 0x41, 0x22,
+    // І (U+0406)
+    0x00, 0x41, 0x7F, 0x41, 0x00,
+    // Ї (U+0407)
+    0x00, 0x43, 0x7E, 0x43, 0x00,
+    // Ў (U+040E)
+    0x0E, 0x51, 0x51, 0x51, 0x3E,
+    // є (U+0454)
+    0x38, 0x54, 0x54, 0x44, 0x28,
+    // і (U+0456)
+    0x00, 0x44, 0x7D, 0x40, 0x00,
+    // ї (U+0457)
+    0x00, 0x45, 0x7C, 0x41, 0x00,
+    // ў (U+045E)
+    0x0D, 0x52, 0x52, 0x52, 0x3D,
+    // Ґ (U+0490)
+    0x7E, 0x02, 0x02, 0x02, 0x03,
+    // ґ (U+0491)
+    0x7C, 0x04, 0x04, 0x04, 0x0E,
+};
+
+// Греческий: Α-Ρ (U+0391 - U+03A1), Σ-Ω (U+03A3 - U+03A9), α-ω (U+03B1 - U+03C9)
+constexpr uint8_t FONT_GREEK[] = {
+    // Α (U+0391)
+    0x7E, 0x11, 0x11, 0x11, 0x7E,
+    // Β (U+0392)
+    0x7F, 0x49, 0x49, 0x49, 0x36,
+    // Γ (U+0393)
+    0x7F, 0x01, 0x01, 0x01, 0x03,
+    // Δ (U+0394)
+    0x70, 0x4C, 0x43, 0x4C, 0x70,
+    // Ε (U+0395)
+    0x7F, 0x49, 0x49, 0x49, 0x41,
+    // Ζ (U+0396)
+    0x61, 0x51, 0x49, 0x45, 0x43,
+    // Η (U+0397)
+    0x7F, 0x08, 0x08, 0x08, 0x7F,
+    // Θ (U+0398)
+    0x3E, 0x49, 0x49, 0x49, 0x3E,
+    // Ι (U+0399)
+    0x00, 0x41, 0x7F, 0x41, 0x00,
+    // Κ (U+039A)
+    0x7F, 0x08, 0x14, 0x22, 0x41,
+    // Λ (U+039B)
+    0x78, 0x06, 0x01, 0x06, 0x78,
+    // Μ (U+039C)
+    0x7F, 0x02, 0x04, 0x02, 0x7F,
+    // Ν (U+039D)
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // Ξ (U+039E)
+    0x41, 0x49, 0x49, 0x49, 0x41,
+    // Ο (U+039F)
+    0x3E, 0x41, 0x41, 0x41, 0x3E,
+    // Π (U+03A0)
+    0x7F, 0x01, 0x01, 0x01, 0x7F,
+    // Ρ (U+03A1)
+    0x7F, 0x09, 0x09, 0x09, 0x06,
+    // Σ (U+03A3)
+    0x63, 0x55, 0x49, 0x41, 0x41,
+    // Τ (U+03A4)
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    // Υ (U+03A5)
+    0x03, 0x04, 0x78, 0x04, 0x03,
+    // Φ (U+03A6)
+    0x0E, 0x11, 0x7F, 0x11, 0x0E,
+    // Χ (U+03A7)
+    0x63, 0x14, 0x08, 0x14, 0x63,
+    // Ψ (U+03A8)
+    0x07, 0x08, 0x7F, 0x08, 0x07,
+    // Ω (U+03A9)
+    0x4E, 0x71, 0x01, 0x71, 0x4E,
+    // α (U+03B1)
+    0x38, 0x44, 0x44, 0x38, 0x44,
+    // β (U+03B2)
+    0x7E, 0x25, 0x25, 0x2A, 0x10,
+    // γ (U+03B3)
+    0x0C, 0x10, 0x60, 0x10, 0x0C,
+    // δ (U+03B4)
+    0x3A, 0x45, 0x45, 0x49, 0x30,
+    // ε (U+03B5)
+    0x28, 0x54, 0x54, 0x44, 0x00,
+    // ζ (U+03B6)
+    0x11, 0x29, 0x25, 0x23, 0x41,
+    // η (U+03B7)
+    0x3C, 0x08, 0x04, 0x04, 0x78,
+    // θ (U+03B8)
+    0x3E, 0x49, 0x49, 0x3E, 0x00,
+    // ι (U+03B9)
+    0x00, 0x3C, 0x40, 0x40, 0x20,
+    // κ (U+03BA)
+    0x7C, 0x10, 0x28, 0x44, 0x00,
+    // λ (U+03BB)
+    0x61, 0x16, 0x08, 0x10, 0x60,
+    // μ (U+03BC)
+    0x7C, 0x20, 0x20, 0x1C, 0x20,
+    // ν (U+03BD)
+    0x1C, 0x20, 0x40, 0x20, 0x1C,
+    // ξ (U+03BE)
+    0x0A, 0x15, 0x55, 0x51, 0x20,
+    // ο (U+03BF)
+    0x38, 0x44, 0x44, 0x44, 0x38,
+    // π (U+03C0)
+    0x04, 0x7C, 0x04, 0x3C, 0x44,
+    // ρ (U+03C1)
+    0x78, 0x24, 0x24, 0x18, 0x00,
+    // ς (U+03C2)
+    0x08, 0x14, 0x54, 0x24, 0x00,
+    // σ (U+03C3)
+    0x38, 0x44, 0x44, 0x4C, 0x34,
+    // τ (U+03C4)
+    0x04, 0x04, 0x3C, 0x44, 0x24,
+    // υ (U+03C5)
+    0x3C, 0x40, 0x40, 0x44, 0x38,
+    // φ (U+03C6)
+    0x18, 0x24, 0x7E, 0x24, 0x18,
+    // χ (U+03C7)
+    0x44, 0x28, 0x10, 0x28, 0x44,
+    // ψ (U+03C8)
+    0x0C, 0x10, 0x7C, 0x10, 0x0C,
+    // ω (U+03C9)
+    0x38, 0x44, 0x30, 0x44, 0x38,
+};
+
+// Псевдографика: линии рамок (U+2500 - U+255D) и блоки (U+2580 - U+2593)
+constexpr uint8_t FONT_BOX_DRAWING[] = {
+    // ─ (U+2500)
+    0x08, 0x08, 0x08, 0x08, 0x08,
+    // │ (U+2502)
+    0x00, 0x00, 0x7F, 0x00, 0x00,
+    // ┌ (U+250C)
+    0x00, 0x00, 0x78, 0x08, 0x08,
+    // ┐ (U+2510)
+    0x08, 0x08, 0x78, 0x00, 0x00,
+    // └ (U+2514)
+    0x00, 0x00, 0x0F, 0x08, 0x08,
+    // ┘ (U+2518)
+    0x08, 0x08, 0x0F, 0x00, 0x00,
+    // ├ (U+251C)
+    0x00, 0x00, 0x7F, 0x08, 0x08,
+    // ┤ (U+2524)
+    0x08, 0x08, 0x7F, 0x00, 0x00,
+    // ┬ (U+252C)
+    0x08, 0x08, 0x78, 0x08, 0x08,
+    // ┴ (U+2534)
+    0x08, 0x08, 0x0F, 0x08, 0x08,
+    // ┼ (U+253C)
+    0x08, 0x08, 0x7F, 0x08, 0x08,
+    // ═ (U+2550)
+    0x14, 0x14, 0x14, 0x14, 0x14,
+    // ║ (U+2551)
+    0x00, 0x7F, 0x00, 0x7F, 0x00,
+    // ╔ (U+2554)
+    0x00, 0x7C, 0x04, 0x74, 0x14,
+    // ╗ (U+2557)
+    0x14, 0x74, 0x04, 0x7C, 0x00,
+    // ╚ (U+255A)
+    0x00, 0x1F, 0x10, 0x17, 0x14,
+    // ╝ (U+255D)
+    0x14, 0x17, 0x10, 0x1F, 0x00,
+    // ▀ (U+2580)
+    0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+    // ▄ (U+2584)
+    0x70, 0x70, 0x70, 0x70, 0x70,
+    // █ (U+2588)
+    0x7F, 0x7F, 0x7F, 0x7F, 0x7F,
+    // ▌ (U+258C)
+    0x7F, 0x7F, 0x7F, 0x00, 0x00,
+    // ▐ (U+2590)
+    0x00, 0x00, 0x00, 0x7F, 0x7F,
+    // ░ (U+2591)
+    0x55, 0x00, 0x55, 0x00, 0x55,
+    // ▒ (U+2592)
+    0x55, 0x2A, 0x55, 0x2A, 0x55,
+    // ▓ (U+2593)
+    0x2A, 0x7F, 0x2A, 0x7F, 0x2A,
+};
+
+// Иконки (Private Use Area U+E000 - U+E00F)
+constexpr uint8_t FONT_ICONS[] = {
+    // U+E000 батарея пустая
+    0x7E, 0x43, 0x43, 0x43, 0x7E,
+    // U+E001 батарея наполовину
+    0x7E, 0x73, 0x73, 0x73, 0x7E,
+    // U+E002 батарея полная
+    0x7E, 0x7F, 0x7F, 0x7F, 0x7E,
+    // U+E003 уровень сигнала
+    0x40, 0x60, 0x70, 0x7C, 0x7F,
+    // U+E004 Bluetooth
+    0x14, 0x08, 0x7F, 0x2A, 0x14,
+    // U+E005 колокольчик
+    0x10, 0x1E, 0x5F, 0x1E, 0x10,
+    // U+E006 замок
+    0x7E, 0x79, 0x49, 0x79, 0x7E,
+    // U+E007 галочка
+    0x08, 0x10, 0x08, 0x04, 0x02,
+    // U+E008 крестик
+    0x22, 0x14, 0x08, 0x14, 0x22,
+    // U+E009 внимание
+    0x78, 0x46, 0x69, 0x46, 0x78,
+    // U+E00A сердце
+    0x0C, 0x1E, 0x3C, 0x1E, 0x0C,
+    // U+E00B термометр
+    0x20, 0x7E, 0x79, 0x7E, 0x20,
+    // U+E00C стрелка влево
+    0x08, 0x1C, 0x2A, 0x08, 0x08,
+    // U+E00D стрелка вверх
+    0x04, 0x02, 0x3F, 0x02, 0x04,
+    // U+E00E стрелка вправо
+    0x08, 0x08, 0x2A, 0x1C, 0x08,
+    // U+E00F стрелка вниз
+    0x10, 0x20, 0x7E, 0x20, 0x10,
+};
+
+} // namespace oled
+
+#endif // OLED_FONT_UNICODE_5X7_HPP
@@ -0,0 +1,95 @@
+/**
+ * @file FrameRotate.cpp
+ * @brief Поворот кадра на 90/270 градусов блоками 8x8
+ */
+
+#include "../../include/oled/domain/FrameRotate.hpp"
+
+#if OLED_ENABLED
+
+#include <cstring>
+
+#if !OLED_NO_SIMD && defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace oled {
+
+void FrameRotate::transpose8x8(const uint8_t* in, uint8_t* out) {
+#if !OLED_NO_SIMD && defined(__SSE2__)
+    // pmovmskb собирает старшие биты 8 байт: это строка out[7].
+    // Сложение байта с собой - сдвиг влево на 1 без переноса в соседний байт
+    __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in));
+    for (int i = 7; i >= 0; --i) {
+        out[i] = static_cast<uint8_t>(_mm_movemask_epi8(v));
+        v = _mm_add_epi8(v, v);
+    }
+#else
+    // Бит (8 * j + i) - элемент (j, i); обмены 2x2, 4x4, 8x8 блоков
+    uint64_t x = 0;
+    for (int j = 7; j >= 0; --j) {
+        x = (x << 8) | in[j];
+    }
+    uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    x ^= t ^ (t << 28);
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<uint8_t>(x >> (8 * i));
+    }
+#endif
+}
+
+void FrameRotate::rotate(const Gfx& logical, Gfx& native, Rotation rotation) {
+    if (rotation != Rotation::R90 && rotation != Rotation::R270) {
+        return;
+    }
+
+    const uint16_t logicalWidth = logical.width();    // = высота панели
+    const uint16_t nativeWidth = native.width();      // = высота холста
+    const uint8_t logicalPages = static_cast<uint8_t>(logical.height() / 8);
+    const uint8_t* src = logical.buffer();
+    uint8_t* dst = native.buffer();
+
+    for (uint8_t page = 0; page < logicalPages; ++page) {
+        uint8_t x0 = 0;
+        uint8_t x1 = 0;
+        if (!logical.pageDirtyRange(page, x0, x1)) {
+            continue;
+        }
+
+        for (int group = x0 / 8; group <= x1 / 8; ++group) {
+            const uint8_t* block = src + static_cast<size_t>(page) * logicalWidth + group * 8;
+            uint8_t bits[8];
+            int nativeX;
+            int nativePage;
+
+            if (rotation == Rotation::R90) {
+                // Холст (x, y) -> панель (W - 1 - y, x): строки блока в обратном порядке
+                transpose8x8(block, bits);
+                nativeX = nativeWidth - 8 - page * 8;
+                nativePage = group;
+                uint8_t* out = dst + static_cast<size_t>(nativePage) * nativeWidth + nativeX;
+                for (int i = 0; i < 8; ++i) {
+                    out[i] = bits[7 - i];
+                }
+            } else {
+                // Холст (x, y) -> панель (y, H - 1 - x): колонки блока в обратном порядке
+                uint8_t reversed[8];
+                for (int j = 0; j < 8; ++j) {
+                    reversed[j] = block[7 - j];
+                }
+                nativeX = page * 8;
+                nativePage = logicalWidth / 8 - 1 - group;
+                transpose8x8(reversed, dst + static_cast<size_t>(nativePage) * nativeWidth + nativeX);
+            }
+            native.markDirty(nativeX, nativePage * 8, 8, 8);
+        }
+    }
+}
+
+} // namespace oled
+
+#endif // OLED_ENABLED
@@ -4,98 +4,700 @@
  */
 
 #include "../../include/oled/domain/Gfx.hpp"
+#include "../../include/oled/domain/FrameRotate.hpp"
 
 #if OLED_ENABLED
 
 #include "Font5x7.hpp"
-#include "FontCyrillic5x7.hpp"
+#include "GlyphIndex5x7.hpp"
+#include <cstdlib>
 #include <cstring>
 #include <algorithm>
 
+#if !OLED_NO_SIMD && defined(__SSE2__)
+    #include <emmintrin.h>
+#elif !OLED_NO_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+#endif
+
 namespace oled {
 
+namespace {
+    // Маски страницы: kPageTopMask[n] - биты n..7, kPageBottomMask[n] - биты 0..n
+    constexpr uint8_t kPageTopMask[8]    = {0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80};
+    constexpr uint8_t kPageBottomMask[8] = {0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+    // Растяжение бит для масштабированного текста: ниббл -> каждый бит повторён scale раз
+    constexpr uint8_t kSpread2[16] = {
+        0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+        0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+    };
+    constexpr uint16_t kSpread3[16] = {
+        0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF,
+        0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF
+    };
+    constexpr uint16_t kSpread4[16] = {
+        0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+        0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF
+    };
+
+    // Максимальный масштаб, для которого есть таблица (7 * 4 = 28 бит колонки)
+    constexpr uint8_t kMaxLutScale = 4;
+
+    // Растянуть 7-битную колонку шрифта по вертикали в scale раз
+    inline uint32_t spreadColumn(uint8_t bits, uint8_t scale) {
+        const uint8_t lo = bits & 0x0F;
+        const uint8_t hi = bits >> 4;
+        switch (scale) {
+            case 2:  return (static_cast<uint32_t>(kSpread2[hi]) << 8) | kSpread2[lo];
+            case 3:  return (static_cast<uint32_t>(kSpread3[hi]) << 12) | kSpread3[lo];
+            case 4:  return (static_cast<uint32_t>(kSpread4[hi]) << 16) | kSpread4[lo];
+            default: return bits;
+        }
+    }
+
+    // Применить растровую операцию к байту (выбирается на этапе компиляции)
+    template <RasterOp Op>
+    inline uint8_t applyRop(uint8_t dst, uint8_t src) {
+        if constexpr (Op == RasterOp::Copy)   return src;
+        if constexpr (Op == RasterOp::Or)     return dst | src;
+        if constexpr (Op == RasterOp::And)    return dst & src;
+        if constexpr (Op == RasterOp::Xor)    return dst ^ src;
+        if constexpr (Op == RasterOp::AndNot) return dst & static_cast<uint8_t>(~src);
+        return static_cast<uint8_t>(~src);
+    }
+
+    // Страница в кольце из pages страниц, начинающемся с origin
+    inline int ringPage(int page, int origin, int pages) {
+        page += origin;
+        return (page >= pages) ? page - pages : page;
+    }
+
+    // Параметры обрезанного blit: колонки [dx0, dx1), строки [dy0, dy1)
+    struct BlitJob {
+        uint8_t* dst;
+        size_t dstStride;
+        int dstPages;
+        int dstOrigin;  // Начало кольца страниц назначения (Gfx::setRingOrigin)
+        const uint8_t* src;
+        size_t srcStride;
+        int srcPages;
+        int srcOrigin;  // Для copyRect - то же кольцо, для внешнего битмапа - 0
+        int dx0, dx1;
+        int dy0, dy1;
+        int colOffset;  // колонка источника = колонка назначения + colOffset
+        int rowOffset;  // строка источника = строка назначения + rowOffset
+    };
+
+    template <RasterOp Op>
+    void runBlit(const BlitJob& job) {
+        const int firstPage = job.dy0 >> 3;
+        const int lastPage = (job.dy1 - 1) >> 3;
+
+        // Порядок обхода для перекрытия внутри одного буфера:
+        // источник выше/левее - идём снизу вверх/справа налево
+        const bool bottomUp = job.rowOffset < 0;
+        const bool rightToLeft = job.colOffset < 0;
+        const int pageStep = bottomUp ? -1 : 1;
+        const int colStep = rightToLeft ? -1 : 1;
+        const int pageBegin = bottomUp ? lastPage : firstPage;
+        const int pageEnd = bottomUp ? firstPage - 1 : lastPage + 1;
+        const int colBegin = rightToLeft ? job.dx1 - 1 : job.dx0;
+        const int colEnd = rightToLeft ? job.dx0 - 1 : job.dx1;
+
+        for (int page = pageBegin; page != pageEnd; page += pageStep) {
+            uint8_t mask = 0xFF;
+            if (page == firstPage) mask &= kPageTopMask[job.dy0 & 7];
+            if (page == lastPage) mask &= kPageBottomMask[(job.dy1 - 1) & 7];
+            const uint8_t keep = static_cast<uint8_t>(~mask);
+
+            // Строка источника для бита 0 этого байта: до двух страниц источника
+            const int srcRow = page * 8 + job.rowOffset;
+            const int srcPage = (srcRow + 8) / 8 - 1;  // floor для srcRow >= -8
+            const uint8_t shift = static_cast<uint8_t>(srcRow & 7);
+            const uint8_t* lo = (srcPage >= 0 && srcPage < job.srcPages)
+                                ? job.src + static_cast<size_t>(ringPage(srcPage, job.srcOrigin, job.srcPages)) *
+                                                job.srcStride
+                                : nullptr;
+            const uint8_t* hi = (shift != 0 && srcPage + 1 >= 0 && srcPage + 1 < job.srcPages)
+                                ? job.src + static_cast<size_t>(ringPage(srcPage + 1, job.srcOrigin, job.srcPages)) *
+                                                job.srcStride
+                                : nullptr;
+
+            uint8_t* row = job.dst + static_cast<size_t>(ringPage(page, job.dstOrigin, job.dstPages)) *
+                                         job.dstStride;
+
+            for (int col = colBegin; col != colEnd; col += colStep) {
+                const int srcCol = col + job.colOffset;
+                uint8_t v = 0;
+                if (lo) v = static_cast<uint8_t>(lo[srcCol] >> shift);
+                if (hi) v = static_cast<uint8_t>(v | (hi[srcCol] << (8 - shift)));
+
+                const uint8_t d = row[col];
+                row[col] = static_cast<uint8_t>((d & keep) | (applyRop<Op>(d, v) & mask));
+            }
+        }
+    }
+
+    // Потоковый декодер колонок глифа пропорционального шрифта
+    class GlyphColumnReader {
+    public:
+        GlyphColumnReader(const uint8_t* data, FontEncoding encoding)
+            : data_(data), rle_(encoding == FontEncoding::Rle) {}
+
+        // Прочитать следующую колонку: бит 0 = верхний пиксель
+        uint32_t next(uint8_t height) {
+            uint32_t bits = 0;
+            uint8_t pos = 0;
+            while (pos < height) {
+                uint8_t take;
+                if (rle_) {
+                    if (runLeft_ == 0) {
+                        const uint8_t b = *data_++;
+                        runOn_ = (b & 0x80) != 0;
+                        runLeft_ = static_cast<uint8_t>((b & 0x7F) + 1);
+                    }
+                    take = std::min<uint8_t>(runLeft_, static_cast<uint8_t>(height - pos));
+                    if (runOn_) {
+                        const uint32_t ones = (take >= 32) ? 0xFFFFFFFFUL : ((1UL << take) - 1);
+                        bits |= ones << pos;
+                    }
+                    runLeft_ = static_cast<uint8_t>(runLeft_ - take);
+                } else {
+                    if (bitPos_ == 8) {
+                        cur_ = *data_++;
+                        bitPos_ = 0;
+                    }
+                    take = std::min<uint8_t>(static_cast<uint8_t>(8 - bitPos_),
+                                             static_cast<uint8_t>(height - pos));
+                    const uint32_t chunk = (cur_ >> bitPos_) & ((1U << take) - 1);
+                    bits |= chunk << pos;
+                    bitPos_ = static_cast<uint8_t>(bitPos_ + take);
+                }
+                pos = static_cast<uint8_t>(pos + take);
+            }
+            return bits;
+        }
+
+    private:
+        const uint8_t* data_;
+        bool rle_;
+        uint8_t cur_ = 0;
+        uint8_t bitPos_ = 8;   // Packed: позиция в текущем байте (8 = нужен новый)
+        uint8_t runLeft_ = 0;  // Rle: остаток текущей серии
+        bool runOn_ = false;
+    };
+
+    // Глиф шрифта или '?' вместо отсутствующего
+    const FontGlyph* glyphOrFallback(const Font& font, uint32_t codepoint) {
+        const FontGlyph* glyph = font.glyph(codepoint);
+        return glyph ? glyph : font.glyph('?');
+    }
+
+    // Шаг пера по тексту: встроенный 5x7 (font == nullptr) или пропорциональный шрифт
+    class TextPen {
+    public:
+        TextPen(const Font* font, uint8_t scale) : font_(font), scale_(scale) {}
+
+        /**
+         * @brief Сдвинуть перо на символ
+         * @param ink Правый край пикселей символа от текущего пера (с кернингом)
+         * @return Шаг пера (с кернингом)
+         */
+        int step(uint32_t codepoint, int& ink) {
+            if (!font_) {
+                ink = FONT_WIDTH * scale_;
+                return (FONT_WIDTH + 1) * scale_;
+            }
+            const FontGlyph* glyph = glyphOrFallback(*font_, codepoint);
+            if (!glyph) {
+                ink = 0;
+                return 0;
+            }
+            const int kern = font_->kern(prev_, glyph);
+            prev_ = glyph;
+            ink = kern + glyph->xOffset + glyph->width;
+            return kern + glyph->advance;
+        }
+
+    private:
+        const Font* font_;
+        uint8_t scale_;
+        const FontGlyph* prev_ = nullptr;
+    };
+
+    constexpr char kEllipsis[] = "...";
+
+    // sin(0..90°) в формате Q14 (16384 = 1.0) - направления для arc()
+    constexpr int16_t kSinQ14[91] = {
+            0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+         2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+         5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+         8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+        10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+        12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+        14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+        15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+        16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+        16384,
+    };
+
+    // Угол в градусах -> [0, 360)
+    inline int normalizeDeg(int deg) {
+        deg %= 360;
+        return deg < 0 ? deg + 360 : deg;
+    }
+
+    inline int32_t sinQ14(int deg) {
+        deg = normalizeDeg(deg);
+        if (deg <= 90)  return kSinQ14[deg];
+        if (deg <= 180) return kSinQ14[180 - deg];
+        if (deg <= 270) return -kSinQ14[deg - 180];
+        return -kSinQ14[360 - deg];
+    }
+
+    inline int32_t cosQ14(int deg) {
+        return sinQ14(deg + 90);
+    }
+
+    // Квадранты окружности для circleQuadrants()/circleColumns()
+    constexpr uint8_t kQuadTopLeft     = 0x01;
+    constexpr uint8_t kQuadTopRight    = 0x02;
+    constexpr uint8_t kQuadBottomRight = 0x04;
+    constexpr uint8_t kQuadBottomLeft  = 0x08;
+    constexpr uint8_t kQuadAll         = 0x0F;
+    constexpr uint8_t kSideLeft        = kQuadTopLeft | kQuadBottomLeft;
+    constexpr uint8_t kSideRight       = kQuadTopRight | kQuadBottomRight;
+
+    // Больше - переполнение int32 в ошибке алгоритма эллипса: 4 * a2 * ry
+    // при rx = ry = 511 - около 5.3e8, в 4 раза меньше INT32_MAX
+    constexpr int kMaxEllipseRadius = 511;
+
+    /**
+     * @brief Обход четверти эллипса (средняя точка, целочисленно)
+     *
+     * visit(x, y) вызывается для точек контура: x растёт от 0 до rx,
+     * y убывает от ry до 0. Для каждого x первая точка - с наибольшим y.
+     * Ошибка хранится умноженной на 4, чтобы обойтись без дробей.
+     * d1, d2 и их приращения - int32, в пределах kMaxEllipseRadius; в int64
+     * считается только начальное d2 (квадраты до приведения к int32).
+     */
+    template <typename Visit>
+    void walkEllipseQuadrant(int rx, int ry, Visit visit) {
+        const int32_t a2 = static_cast<int32_t>(rx) * rx;
+        const int32_t b2 = static_cast<int32_t>(ry) * ry;
+        int x = 0;
+        int y = ry;
+        int32_t dx = 0;
+        int32_t dy = 2 * a2 * y;
+
+        // Область 1: наклон меньше 1, x растёт каждый шаг
+        int32_t d1 = 4 * b2 - 4 * a2 * ry + a2;
+        while (dx < dy) {
+            visit(x, y);
+            ++x;
+            dx += 2 * b2;
+            if (d1 < 0) {
+                d1 += 4 * (dx + b2);
+            } else {
+                --y;
+                dy -= 2 * a2;
+                d1 += 4 * (dx - dy + b2);
+            }
+        }
+
+        // Область 2: y убывает каждый шаг
+        int32_t d2 = static_cast<int32_t>(
+            static_cast<int64_t>(b2) * (2 * x + 1) * (2 * x + 1) +
+            4 * static_cast<int64_t>(a2) * (y - 1) * (y - 1) -
+            4 * static_cast<int64_t>(a2) * b2);
+        while (y >= 0) {
+            visit(x, y);
+            --y;
+            dy -= 2 * a2;
+            if (d2 > 0) {
+                d2 += 4 * (a2 - dy);
+            } else {
+                ++x;
+                dx += 2 * b2;
+                d2 += 4 * (dx - dy + a2);
+            }
+        }
+    }
+
+    // Слово для SWAR-проверки ASCII: 8 байт на 64-битных платформах, иначе 4
+#if UINTPTR_MAX > 0xFFFFFFFFu
+    using SwarWord = uint64_t;
+#else
+    using SwarWord = uint32_t;
+#endif
+    constexpr SwarWord kSwarOnes = static_cast<SwarWord>(~static_cast<SwarWord>(0)) / 0xFF;  // 0x01 в каждом байте
+    constexpr SwarWord kSwarHigh = kSwarOnes * 0x80;
+    constexpr SwarWord kSwarSpace = kSwarOnes * 0x20;
+
+    // true, если все байты слова печатные ASCII (0x20..0x7F): нет старшего бита и байтов < 0x20
+    inline bool swarPrintable(SwarWord w) {
+        return ((w | ((w - kSwarSpace) & ~w)) & kSwarHigh) == 0;
+    }
+
+    inline bool isPrintableAscii(uint8_t b) {
+        return b >= 0x20 && b < 0x80;
+    }
+
+    /**
+     * @brief Длина префикса печатных ASCII байт (без управляющих символов и UTF-8)
+     *
+     * Проверяет по 16 байт (SSE2/NEON на host) или по слову (SWAR), хвост - побайтно.
+     * Читает только внутри [str, str + len).
+     */
+    size_t asciiRunLength(const char* str, size_t len) {
+        size_t n = 0;
+
+#if !OLED_NO_SIMD && defined(__SSE2__)
+        const __m128i space = _mm_set1_epi8(0x20);
+        while (n + 16 <= len) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + n));
+            // Знаковое сравнение: байты >= 0x80 отрицательные и тоже попадают в маску
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(v, space)));
+            if (mask != 0) {
+                return n + static_cast<size_t>(__builtin_ctz(mask));
+            }
+            n += 16;
+        }
+#elif !OLED_NO_SIMD && defined(__ARM_NEON) && defined(__aarch64__)
+        const uint8x16_t space = vdupq_n_u8(0x20);
+        const uint8x16_t high = vdupq_n_u8(0x80);
+        while (n + 16 <= len) {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(str + n));
+            const uint8x16_t bad = vorrq_u8(vcltq_u8(v, space), vcgeq_u8(v, high));
+            if (vmaxvq_u8(bad) != 0) {
+                break;  // Позицию найдёт SWAR/побайтный хвост
+            }
+            n += 16;
+        }
+#endif
+
+        while (n + sizeof(SwarWord) <= len) {
+            SwarWord w;
+            memcpy(&w, str + n, sizeof(w));
+            if (!swarPrintable(w)) {
+                break;
+            }
+            n += sizeof(SwarWord);
+        }
+        while (n < len && isPrintableAscii(static_cast<uint8_t>(str[n]))) {
+            ++n;
+        }
+        return n;
+    }
+
+    // Деление с округлением вниз (для отрицательных наклонов)
+    inline int64_t floorDiv(int64_t a, int32_t b) {
+        int64_t q = a / b;
+        return (q * b > a) ? q - 1 : q;
+    }
+
+    /**
+     * @brief Ребро a-b (a.x != b.x), пересечение на колонке min(a.x, b.x)
+     */
+    PolygonEdge makeEdge(int ax, int ay, int bx, int by) {
+        if (ax > bx) {
+            std::swap(ax, bx);
+            std::swap(ay, by);
+        }
+        PolygonEdge e;
+        e.xStart = static_cast<int16_t>(ax);
+        e.xEnd = static_cast<int16_t>(bx);
+        e.y = ay;
+        e.num = 0;
+        e.dx = bx - ax;
+        e.stepY = static_cast<int32_t>(floorDiv(by - ay, e.dx));
+        e.stepNum = (by - ay) - e.stepY * e.dx;
+        return e;
+    }
+
+    // Сдвинуть пересечение на steps колонок вправо
+    inline void advanceEdge(PolygonEdge& e, int32_t steps) {
+        if (steps == 0) {
+            return;
+        }
+        if (steps == 1) {
+            e.y += e.stepY;
+            e.num += e.stepNum;
+            if (e.num >= e.dx) {
+                e.num -= e.dx;
+                ++e.y;
+            }
+            return;
+        }
+        int64_t num = e.num + static_cast<int64_t>(steps) * e.stepNum;
+        int64_t carry = num / e.dx;
+        e.y += static_cast<int32_t>(steps * static_cast<int64_t>(e.stepY) + carry);
+        e.num = static_cast<int32_t>(num - carry * e.dx);
+    }
+
+    /**
+     * @brief Видимый диапазон шагов отрезка по главной оси
+     *
+     * Точка t = 0..d: major = m0 + t, minor = n0 + s * off(t), где
+     * off(t) = floor((2 * t * a + d) / (2 * d)) - округление t * a / d
+     * (0 < a <= d). Ищет [tMin, tMax], где major в [0, majorLimit) и
+     * minor в [0, minorLimit). off(t) не убывает, поэтому диапазон сплошной.
+     */
+    bool clipSegment(int m0, int n0, int32_t d, int32_t a, int s,
+                     int majorLimit, int minorLimit, int32_t& tMin, int32_t& tMax) {
+        int64_t lo = std::max<int64_t>(0, -static_cast<int64_t>(m0));
+        int64_t hi = std::min<int64_t>(d, static_cast<int64_t>(majorLimit) - 1 - m0);
+
+        // Допустимые off: [low, high]
+        const int64_t low  = (s > 0) ? -static_cast<int64_t>(n0) : static_cast<int64_t>(n0) - (minorLimit - 1);
+        const int64_t high = (s > 0) ? static_cast<int64_t>(minorLimit) - 1 - n0 : static_cast<int64_t>(n0);
+        if (high < 0) {
+            return false;
+        }
+        if (low > 0) {
+            // off(t) >= low  <=>  t >= (2 * d * low - d) / (2 * a)
+            const int64_t num = 2 * static_cast<int64_t>(d) * low - d;
+            lo = std::max(lo, (num + 2 * a - 1) / (2 * a));
+        }
+        // off(t) <= high  <=>  2 * t * a + d < 2 * d * (high + 1)
+        hi = std::min(hi, (2 * static_cast<int64_t>(d) * (high + 1) - d - 1) / (2 * a));
+
+        if (lo > hi) {
+            return false;
+        }
+        tMin = static_cast<int32_t>(lo);
+        tMax = static_cast<int32_t>(hi);
+        return true;
+    }
+
+    // Пересечение a выше пересечения b: сравнение y + num / dx без деления
+    inline bool edgeAbove(const PolygonEdge& a, const PolygonEdge& b) {
+        if (a.y != b.y) {
+            return a.y < b.y;
+        }
+        return static_cast<int64_t>(a.num) * b.dx < static_cast<int64_t>(b.num) * a.dx;
+    }
+} // anonymous namespace
+
 void Gfx::init(uint8_t* buffer, uint16_t width, uint16_t height) {
     buffer_ = buffer;
     width_ = width;
     height_ = height;
+    ringOrigin_ = 0;
     cursorX_ = 0;
     cursorY_ = 0;
     textScale_ = 1;
     textColor_ = true;
+    font_ = nullptr;
+    prevGlyph_ = nullptr;
+    clearDirty();
 }
 
-void Gfx::clear() {
-    if (buffer_) {
-        memset(buffer_, 0x00, bufferSize());
+void Gfx::markDirty(int x, int y, int w, int h) {
+    if (!clipRect(x, y, w, h)) {
+        return;
     }
+    markDirtyClipped(x, x + w - 1, y >> 3, (y + h - 1) >> 3);
 }
 
-void Gfx::fill(bool color) {
-    if (buffer_) {
-        memset(buffer_, color ? 0xFF : 0x00, bufferSize());
+void Gfx::markAllDirty() {
+    markDirty(0, 0, width_, height_);
+}
+
+void Gfx::clearDirty() {
+    memset(dirtyMin_, 0xFF, sizeof(dirtyMin_));
+    memset(dirtyMax_, 0x00, sizeof(dirtyMax_));
+}
+
+bool Gfx::isDirty() const {
+    const uint8_t pages = static_cast<uint8_t>(std::min<int>(height_ / 8, MAX_PAGES));
+    for (uint8_t page = 0; page < pages; ++page) {
+        if (dirtyMin_[page] <= dirtyMax_[page]) {
+            return true;
+        }
     }
+    return false;
+}
+
+bool Gfx::pageDirtyRange(uint8_t page, uint8_t& x0, uint8_t& x1) const {
+    if (page >= height_ / 8 || page >= MAX_PAGES || dirtyMin_[page] > dirtyMax_[page]) {
+        return false;
+    }
+    x0 = dirtyMin_[page];
+    x1 = dirtyMax_[page];
+    return true;
+}
+
+void Gfx::markDirtyClipped(int x0, int x1, int page0, int page1) {
+    // При ненулевом начале кольца страниц не больше MAX_PAGES (см. setRingOrigin)
+    if (page1 >= MAX_PAGES) page1 = MAX_PAGES - 1;
+    for (int page = page0; page <= page1; ++page) {
+        const int phys = physPage(page);
+        if (x0 < dirtyMin_[phys]) dirtyMin_[phys] = static_cast<uint8_t>(x0);
+        if (x1 > dirtyMax_[phys]) dirtyMax_[phys] = static_cast<uint8_t>(x1);
+    }
+}
+
+void Gfx::setRingOrigin(uint8_t page) {
+    const int pages = height_ >> 3;
+    if (pages == 0 || pages > MAX_PAGES) {
+        return;
+    }
+    ringOrigin_ = static_cast<uint8_t>(page % pages);
+}
+
+void Gfx::clear() {
+    fillArea(0, 0, width_, height_, false);
+}
+
+void Gfx::fill(bool color) {
+    fillArea(0, 0, width_, height_, color);
 }
 
-void Gfx::pixel(int x, int y, bool color) {
-    // Проверка границ
-    if (x < 0 || x >= width_ || y < 0 || y >= height_) {
+void Gfx::line(int x0, int y0, int x1, int y1, bool color) {
+    if (!buffer_) return;
+
+    // Прямые - span
+    if (y0 == y1) {
+        fillArea(std::min(x0, x1), y0, std::abs(x1 - x0) + 1, 1, color);
         return;
     }
-    if (!buffer_) {
+    if (x0 == x1) {
+        fillArea(x0, std::min(y0, y1), 1, std::abs(y1 - y0) + 1, color);
         return;
     }
 
-    // Вычисление позиции в буфере
-    // Буфер организован: page[0..7] * width колонок
-    // Каждый байт = 8 вертикальных пикселей (LSB = верхний)
-    uint16_t page = y / 8;
-    uint8_t bit = y % 8;
-    size_t idx = static_cast<size_t>(page) * width_ + x;
+    // Рисуем всегда в сторону роста главной оси: пиксели не зависят от порядка концов
+    const int32_t dx = std::abs(x1 - x0);
+    const int32_t dy = std::abs(y1 - y0);
+    int32_t tMin = 0;
+    int32_t tMax = 0;
+    if (dx >= dy) {
+        if (x0 > x1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        const int sy = (y1 > y0) ? 1 : -1;
+        if (!clipSegment(x0, y0, dx, dy, sy, width_, height_, tMin, tMax)) return;
 
-    if (color) {
-        buffer_[idx] |= (1 << bit);
+        const int64_t acc = 2 * static_cast<int64_t>(tMin) * dy + dx;
+        const int32_t off = static_cast<int32_t>(acc / (2 * dx));
+        const int32_t rem = static_cast<int32_t>(acc - static_cast<int64_t>(off) * 2 * dx);
+        if (sy > 0) {
+            lineShallow<1>(x0 + tMin, y0 + off, tMax - tMin + 1, rem, 2 * dy, 2 * dx, color);
+        } else {
+            lineShallow<-1>(x0 + tMin, y0 - off, tMax - tMin + 1, rem, 2 * dy, 2 * dx, color);
+        }
     } else {
-        buffer_[idx] &= ~(1 << bit);
+        if (y0 > y1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        const int sx = (x1 > x0) ? 1 : -1;
+        if (!clipSegment(y0, x0, dy, dx, sx, height_, width_, tMin, tMax)) return;
+
+        const int64_t acc = 2 * static_cast<int64_t>(tMin) * dx + dy;
+        const int32_t off = static_cast<int32_t>(acc / (2 * dy));
+        const int32_t rem = static_cast<int32_t>(acc - static_cast<int64_t>(off) * 2 * dy);
+        if (sx > 0) {
+            lineSteep<1>(x0 + off, y0 + tMin, tMax - tMin + 1, rem, 2 * dx, 2 * dy, color);
+        } else {
+            lineSteep<-1>(x0 - off, y0 + tMin, tMax - tMin + 1, rem, 2 * dx, 2 * dy, color);
+        }
     }
 }
 
-void Gfx::line(int x0, int y0, int x1, int y1, bool color) {
-    // Алгоритм Брезенхэма
-    int dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
-    int dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
-    int sx = (x0 < x1) ? 1 : -1;
-    int sy = (y0 < y1) ? 1 : -1;
-    int err = dx - dy;
+template <int StepY>
+void Gfx::lineShallow(int x, int y, int32_t count, int32_t rem, int32_t twoMinor, int32_t twoMajor,
+                      bool color) {
+    const uint8_t ink = color ? 0xFF : 0x00;
+    uint8_t* p = pageRow(y >> 3) + x;
+    uint8_t mask = static_cast<uint8_t>(1 << (y & 7));
+    int page = y >> 3;
+    int pageX0 = x;
 
     while (true) {
-        pixel(x0, y0, color);
+        *p = static_cast<uint8_t>((*p & ~mask) | (mask & ink));
+        if (--count == 0) break;
 
-        if (x0 == x1 && y0 == y1) {
-            break;
+        rem += twoMinor;
+        if (rem >= twoMajor) {
+            rem -= twoMajor;
+            // Переход на соседнюю страницу - закрываем dirty-диапазон текущей
+            if (StepY > 0) {
+                mask = static_cast<uint8_t>(mask << 1);
+                if (mask == 0) {
+                    markDirtyClipped(pageX0, x, page, page);
+                    mask = 0x01;
+                    ++page;
+                    p = pageRow(page) + x;
+                    pageX0 = x + 1;
+                }
+            } else {
+                mask = static_cast<uint8_t>(mask >> 1);
+                if (mask == 0) {
+                    markDirtyClipped(pageX0, x, page, page);
+                    mask = 0x80;
+                    --page;
+                    p = pageRow(page) + x;
+                    pageX0 = x + 1;
+                }
+            }
+        }
+        ++p;
+        ++x;
+    }
+    markDirtyClipped(pageX0, x, page, page);
+}
+
+template <int StepX>
+void Gfx::lineSteep(int x, int y, int32_t count, int32_t rem, int32_t twoMinor, int32_t twoMajor,
+                    bool color) {
+    uint8_t* p = pageRow(y >> 3) + x;
+    uint8_t mask = static_cast<uint8_t>(1 << (y & 7));
+    uint8_t bits = 0;
+    int page = y >> 3;
+    int pageX0 = x;
+
+    while (true) {
+        bits |= mask;
+        if (--count == 0) break;
+
+        rem += twoMinor;
+        const bool stepX = (rem >= twoMajor);
+        if (stepX) {
+            rem -= twoMajor;
         }
+        mask = static_cast<uint8_t>(mask << 1);
 
-        int e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x0 += sx;
+        // Байт закончен: сдвиг по X или конец страницы
+        if (stepX || mask == 0) {
+            *p = color ? static_cast<uint8_t>(*p | bits) : static_cast<uint8_t>(*p & ~bits);
+            bits = 0;
         }
-        if (e2 < dx) {
-            err += dx;
-            y0 += sy;
+        if (mask == 0) {
+            markDirtyClipped(std::min(pageX0, x), std::max(pageX0, x), page, page);
+            mask = 0x01;
+            ++page;
+            p = pageRow(page) + x;
+            pageX0 = x + (stepX ? StepX : 0);
+        }
+        if (stepX) {
+            p += StepX;
+            x += StepX;
         }
     }
+    *p = color ? static_cast<uint8_t>(*p | bits) : static_cast<uint8_t>(*p & ~bits);
+    markDirtyClipped(std::min(pageX0, x), std::max(pageX0, x), page, page);
 }
 
 void Gfx::hLine(int x, int y, int w, bool color) {
-    for (int i = 0; i < w; ++i) {
-        pixel(x + i, y, color);
-    }
+    fillArea(x, y, w, 1, color);
 }
 
 void Gfx::vLine(int x, int y, int h, bool color) {
-    for (int i = 0; i < h; ++i) {
-        pixel(x, y + i, color);
-    }
+    fillArea(x, y, 1, h, color);
 }
 
 void Gfx::rect(int x, int y, int w, int h, bool color) {
@@ -108,14 +710,542 @@ void Gfx::rect(int x, int y, int w, int h, bool color) {
 }
 
 void Gfx::rectFill(int x, int y, int w, int h, bool color) {
-    for (int j = 0; j < h; ++j) {
-        hLine(x, y + j, w, color);
+    fillArea(x, y, w, h, color);
+}
+
+void Gfx::circleQuadrants(int x0, int y0, int r, uint8_t quadrants, bool color) {
+    // Средняя точка: 8-кратная симметрия, пары (x, y) и (y, x) на октант
+    int x = 0;
+    int y = r;
+    int d = 1 - r;
+
+    while (x <= y) {
+        if (quadrants & kQuadTopLeft) {
+            pixel(x0 - y, y0 - x, color);
+            pixel(x0 - x, y0 - y, color);
+        }
+        if (quadrants & kQuadTopRight) {
+            pixel(x0 + x, y0 - y, color);
+            pixel(x0 + y, y0 - x, color);
+        }
+        if (quadrants & kQuadBottomRight) {
+            pixel(x0 + x, y0 + y, color);
+            pixel(x0 + y, y0 + x, color);
+        }
+        if (quadrants & kQuadBottomLeft) {
+            pixel(x0 - y, y0 + x, color);
+            pixel(x0 - x, y0 + y, color);
+        }
+
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            --y;
+        }
+        ++x;
+    }
+}
+
+void Gfx::circleColumns(int x0, int y0, int r, uint8_t sides, int stretch, bool color) {
+    // Те же шаги, что в circleQuadrants(), но каждая колонка - один вертикальный span
+    // высотой 2 * dy + 1 + stretch (stretch растягивает круг в скруглённый прямоугольник)
+    int x = 0;
+    int y = r;
+    int d = 1 - r;
+    int prevX = 0;
+    int prevY = r;
+
+    while (x < y) {
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            --y;
+        }
+        ++x;
+
+        // Колонки x0 +- x: высота y
+        if (x <= y) {
+            if (sides & kSideRight) fillArea(x0 + x, y0 - y, 1, 2 * y + 1 + stretch, color);
+            if (sides & kSideLeft)  fillArea(x0 - x, y0 - y, 1, 2 * y + 1 + stretch, color);
+        }
+        // Колонки x0 +- y: одна на каждое значение y, с наибольшей высотой
+        if (y != prevY) {
+            if (sides & kSideRight) fillArea(x0 + prevY, y0 - prevX, 1, 2 * prevX + 1 + stretch, color);
+            if (sides & kSideLeft)  fillArea(x0 - prevY, y0 - prevX, 1, 2 * prevX + 1 + stretch, color);
+            prevY = y;
+        }
+        prevX = x;
+    }
+}
+
+void Gfx::circle(int x0, int y0, int r, bool color) {
+    if (r < 0) return;
+    circleQuadrants(x0, y0, r, kQuadAll, color);
+}
+
+void Gfx::circleFill(int x0, int y0, int r, bool color) {
+    if (r < 0) return;
+    fillArea(x0, y0 - r, 1, 2 * r + 1, color);
+    circleColumns(x0, y0, r, kSideLeft | kSideRight, 0, color);
+}
+
+void Gfx::ellipse(int x0, int y0, int rx, int ry, bool color) {
+    if (rx < 0 || ry < 0 || rx > kMaxEllipseRadius || ry > kMaxEllipseRadius) return;
+    if (rx == 0 || ry == 0) {
+        fillArea(x0 - rx, y0 - ry, 2 * rx + 1, 2 * ry + 1, color);
+        return;
+    }
+
+    walkEllipseQuadrant(rx, ry, [&](int x, int y) {
+        pixel(x0 + x, y0 + y, color);
+        pixel(x0 - x, y0 + y, color);
+        pixel(x0 + x, y0 - y, color);
+        pixel(x0 - x, y0 - y, color);
+    });
+}
+
+void Gfx::ellipseFill(int x0, int y0, int rx, int ry, bool color) {
+    if (rx < 0 || ry < 0 || rx > kMaxEllipseRadius || ry > kMaxEllipseRadius) return;
+    if (rx == 0 || ry == 0) {
+        fillArea(x0 - rx, y0 - ry, 2 * rx + 1, 2 * ry + 1, color);
+        return;
+    }
+
+    // Одна колонка на x: первая точка контура для x - самая высокая
+    int lastX = -1;
+    walkEllipseQuadrant(rx, ry, [&](int x, int y) {
+        if (x == lastX) {
+            return;
+        }
+        lastX = x;
+        fillArea(x0 + x, y0 - y, 1, 2 * y + 1, color);
+        if (x != 0) {
+            fillArea(x0 - x, y0 - y, 1, 2 * y + 1, color);
+        }
+    });
+}
+
+void Gfx::arc(int x0, int y0, int r, int startDeg, int endDeg, bool color) {
+    if (r < 0 || r > kMaxEllipseRadius || startDeg == endDeg) return;
+
+    const int span = endDeg - startDeg;
+    if (span >= 360 || span <= -360) {
+        circleQuadrants(x0, y0, r, kQuadAll, color);
+        return;
+    }
+
+    // Дуга по часовой стрелке от start до end (экранные координаты, Y вниз)
+    const int32_t sx = cosQ14(startDeg);
+    const int32_t sy = sinQ14(startDeg);
+    const int32_t ex = cosQ14(endDeg);
+    const int32_t ey = sinQ14(endDeg);
+    const bool wide = normalizeDeg(span) > 180;
+
+    // Точка внутри сектора: по часовой от start и против часовой от end
+    auto plot = [&](int px, int py) {
+        const bool afterStart = sx * py - sy * px >= 0;
+        const bool beforeEnd = px * ey - py * ex >= 0;
+        if (wide ? (afterStart || beforeEnd) : (afterStart && beforeEnd)) {
+            pixel(x0 + px, y0 + py, color);
+        }
+    };
+
+    int x = 0;
+    int y = r;
+    int d = 1 - r;
+    while (x <= y) {
+        plot(x, y);   plot(y, x);   plot(-x, y);  plot(-y, x);
+        plot(x, -y);  plot(y, -x);  plot(-x, -y); plot(-y, -x);
+        if (d < 0) {
+            d += 2 * x + 3;
+        } else {
+            d += 2 * (x - y) + 5;
+            --y;
+        }
+        ++x;
+    }
+}
+
+void Gfx::roundRect(int x, int y, int w, int h, int r, bool color) {
+    if (w <= 0 || h <= 0) return;
+    r = std::max(0, std::min(r, std::min(w, h) / 2));
+
+    hLine(x + r, y, w - 2 * r, color);           // Верхняя
+    hLine(x + r, y + h - 1, w - 2 * r, color);   // Нижняя
+    vLine(x, y + r, h - 2 * r, color);           // Левая
+    vLine(x + w - 1, y + r, h - 2 * r, color);   // Правая
+    if (r == 0) return;
+
+    circleQuadrants(x + r, y + r, r, kQuadTopLeft, color);
+    circleQuadrants(x + w - r - 1, y + r, r, kQuadTopRight, color);
+    circleQuadrants(x + w - r - 1, y + h - r - 1, r, kQuadBottomRight, color);
+    circleQuadrants(x + r, y + h - r - 1, r, kQuadBottomLeft, color);
+}
+
+void Gfx::roundRectFill(int x, int y, int w, int h, int r, bool color) {
+    if (w <= 0 || h <= 0) return;
+    r = std::max(0, std::min(r, std::min(w, h) / 2));
+
+    // Середина - прямоугольник на всю высоту, по бокам - колонки четвертей круга
+    fillArea(x + r, y, w - 2 * r, h, color);
+    if (r == 0) return;
+
+    const int stretch = h - 2 * r - 1;
+    circleColumns(x + w - r - 1, y + r, r, kSideRight, stretch, color);
+    circleColumns(x + r, y + r, r, kSideLeft, stretch, color);
+}
+
+void Gfx::edgeSpan(int x, const PolygonEdge& a, const PolygonEdge& b, bool color) {
+    // Строки, чьи центры лежат между пересечениями (границы - на контуре)
+    int32_t top = a.y + (a.num > 0 ? 1 : 0);
+    int32_t bottom = b.y;
+    if (top < 0) top = 0;
+    if (bottom >= height_) bottom = height_ - 1;
+    if (top <= bottom) {
+        fillArea(x, static_cast<int>(top), 1, static_cast<int>(bottom - top + 1), color);
+    }
+}
+
+bool Gfx::polygonFill(const Point* points, size_t count,
+                      PolygonEdge* edges, size_t edgeCapacity, bool color) {
+    if (!points || count < 3 || !edges) return false;
+
+    // Таблица рёбер: вертикальные рёбра пропускаются, их закрывает контур
+    size_t edgeCount = 0;
+    int minX = points[0].x;
+    int maxX = points[0].x;
+    for (size_t i = 0; i < count; ++i) {
+        const Point& a = points[i];
+        const Point& b = points[(i + 1 == count) ? 0 : i + 1];
+        minX = std::min<int>(minX, a.x);
+        maxX = std::max<int>(maxX, a.x);
+        if (a.x == b.x) continue;
+        if (edgeCount == edgeCapacity) return false;
+
+        // Вставка с сортировкой по первой колонке
+        PolygonEdge e = makeEdge(a.x, a.y, b.x, b.y);
+        size_t j = edgeCount++;
+        while (j > 0 && edges[j - 1].xStart > e.xStart) {
+            edges[j] = edges[j - 1];
+            --j;
+        }
+        edges[j] = e;
+    }
+
+    // Обход колонок: edges[0, active) - активные рёбра по возрастанию y,
+    // edges[next, edgeCount) - ещё не начавшиеся. Всегда active <= next.
+    const int xFirst = std::max(minX, 0);
+    const int xLast = std::min(maxX, static_cast<int>(width_));
+    size_t active = 0;
+    size_t next = 0;
+    for (int x = xFirst; x < xLast; ++x) {
+        size_t kept = 0;
+        for (size_t i = 0; i < active; ++i) {
+            if (edges[i].xEnd > x) {
+                edges[kept++] = edges[i];
+            }
+        }
+        active = kept;
+
+        while (next < edgeCount && edges[next].xStart <= x) {
+            PolygonEdge e = edges[next++];
+            if (e.xEnd <= x) continue;
+            advanceEdge(e, x - e.xStart);   // Начало ребра за левым краем
+            edges[active++] = e;
+        }
+
+        // Рёбра почти упорядочены с прошлой колонки - сортировка вставками
+        for (size_t i = 1; i < active; ++i) {
+            PolygonEdge e = edges[i];
+            size_t j = i;
+            while (j > 0 && edgeAbove(e, edges[j - 1])) {
+                edges[j] = edges[j - 1];
+                --j;
+            }
+            edges[j] = e;
+        }
+
+        for (size_t i = 0; i + 1 < active; i += 2) {
+            edgeSpan(x, edges[i], edges[i + 1], color);
+        }
+        for (size_t i = 0; i < active; ++i) {
+            advanceEdge(edges[i], 1);
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const Point& a = points[i];
+        const Point& b = points[(i + 1 == count) ? 0 : i + 1];
+        line(a.x, a.y, b.x, b.y, color);
+    }
+    return true;
+}
+
+void Gfx::triangleFill(int x0, int y0, int x1, int y1, int x2, int y2, bool color) {
+    // Контур - в исходном порядке вершин, как у polygonFill()
+    line(x0, y0, x1, y1, color);
+    line(x1, y1, x2, y2, color);
+    line(x2, y2, x0, y0, color);
+
+    // Вершины по возрастанию x: a, b, c
+    if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+    if (x1 > x2) { std::swap(x1, x2); std::swap(y1, y2); }
+    if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+
+    // Длинное ребро a-c активно на всех колонках, короткое - a-b, затем b-c
+    const int xFirst = std::max(x0, 0);
+    const int xLast = std::min(x2, static_cast<int>(width_));
+    if (xFirst < xLast) {
+        PolygonEdge longEdge = makeEdge(x0, y0, x2, y2);
+        bool lower = (x1 <= xFirst);
+        PolygonEdge shortEdge = lower ? makeEdge(x1, y1, x2, y2) : makeEdge(x0, y0, x1, y1);
+        advanceEdge(longEdge, xFirst - longEdge.xStart);
+        advanceEdge(shortEdge, xFirst - shortEdge.xStart);
+
+        for (int x = xFirst; x < xLast; ++x) {
+            if (!lower && x == x1) {
+                shortEdge = makeEdge(x1, y1, x2, y2);
+                lower = true;
+            }
+            if (edgeAbove(shortEdge, longEdge)) {
+                edgeSpan(x, shortEdge, longEdge, color);
+            } else {
+                edgeSpan(x, longEdge, shortEdge, color);
+            }
+            advanceEdge(longEdge, 1);
+            advanceEdge(shortEdge, 1);
+        }
+    }
+}
+
+bool Gfx::clipRect(int& x, int& y, int& w, int& h) const {
+    if (!buffer_ || w <= 0 || h <= 0) {
+        return false;
+    }
+
+    // Обрезка без переполнения: сначала сдвигаем начало, потом ограничиваем длину
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    if (x >= width_ || y >= height_ || w <= 0 || h <= 0) {
+        return false;
+    }
+    if (w > width_ - x) {
+        w = width_ - x;
+    }
+    if (h > height_ - y) {
+        h = height_ - y;
+    }
+    return true;
+}
+
+void Gfx::fillArea(int x, int y, int w, int h, bool color) {
+    if (!clipRect(x, y, w, h)) {
+        return;
+    }
+
+    const int firstPage = y >> 3;
+    const int lastPage = (y + h - 1) >> 3;
+    markDirtyClipped(x, x + w - 1, firstPage, lastPage);
+
+    const uint8_t topMask = kPageTopMask[y & 7];
+    const uint8_t bottomMask = kPageBottomMask[(y + h - 1) & 7];
+    const size_t len = static_cast<size_t>(w);
+    const uint8_t fillByte = color ? 0xFF : 0x00;
+
+    int page = firstPage;
+    while (page <= lastPage) {
+        uint8_t mask = 0xFF;
+        if (page == firstPage) mask &= topMask;
+        if (page == lastPage) mask &= bottomMask;
+
+        uint8_t* row = pageRow(page) + x;
+
+        if (mask != 0xFF) {
+            // Частичная страница: read-modify-write по маске
+            if (color) {
+                for (size_t i = 0; i < len; ++i) row[i] |= mask;
+            } else {
+                const uint8_t keep = static_cast<uint8_t>(~mask);
+                for (size_t i = 0; i < len; ++i) row[i] &= keep;
+            }
+            ++page;
+            continue;
+        }
+
+        // Полные страницы на всю ширину лежат в буфере подряд - один memset на всех
+        // (до конца буфера: дальше кольцо страниц продолжается с его начала)
+        if (len == width_) {
+            const int physLeft = (height_ >> 3) - physPage(page);
+            int run = 1;
+            while (run < physLeft &&
+                   (page + run < lastPage || (page + run == lastPage && bottomMask == 0xFF))) {
+                ++run;
+            }
+            memset(row, fillByte, len * static_cast<size_t>(run));
+            page += run;
+            continue;
+        }
+
+        memset(row, fillByte, len);
+        ++page;
+    }
+}
+
+void Gfx::blit(int x, int y, int w, int h, const uint8_t* src, RasterOp op) {
+    if (!src) {
+        return;
+    }
+
+    const int srcPages = (h + 7) / 8;
+    const size_t srcStride = static_cast<size_t>(w > 0 ? w : 0);
+    int dx = x;
+    int dy = y;
+    if (!clipRect(dx, dy, w, h)) {
+        return;
+    }
+    blitClipped(dx, dy, w, h, src, srcStride, srcPages, dx - x, dy - y, op);
+}
+
+void Gfx::copyRect(int srcX, int srcY, int w, int h, int dstX, int dstY, RasterOp op) {
+    // Обрезка источника, затем назначения - сдвиг переносится на обе стороны
+    int sx = srcX;
+    int sy = srcY;
+    if (!clipRect(sx, sy, w, h)) {
+        return;
+    }
+    int dx = dstX + (sx - srcX);
+    int dy = dstY + (sy - srcY);
+    const int origDx = dx;
+    const int origDy = dy;
+    if (!clipRect(dx, dy, w, h)) {
+        return;
+    }
+    sx += dx - origDx;
+    sy += dy - origDy;
+
+    blitClipped(dx, dy, w, h, buffer_, width_, height_ / 8, sx, sy, op);
+}
+
+void Gfx::scroll(int x, int y, int w, int h, int dx, int dy, bool fill) {
+    if (!clipRect(x, y, w, h) || (dx == 0 && dy == 0)) {
+        return;
+    }
+    if (std::abs(dx) >= w || std::abs(dy) >= h) {
+        fillArea(x, y, w, h, fill);
+        return;
+    }
+
+    const int firstPage = y >> 3;
+    const int lastPage = (y + h - 1) >> 3;
+    const int pages = height_ >> 3;
+    markDirtyClipped(x, x + w - 1, firstPage, lastPage);
+
+    // Колонки назначения, получающие данные из области
+    const int colFirst = (dx > 0) ? x + dx : x;
+    const int cols = w - std::abs(dx);
+    const int colLast = colFirst + cols - 1;
+
+    // Источник выше/левее - обход снизу вверх/справа налево
+    const int pageStep = (dy > 0) ? -1 : 1;
+    const int pageBegin = (dy > 0) ? lastPage : firstPage;
+    const int pageEnd = (dy > 0) ? firstPage - 1 : lastPage + 1;
+
+    for (int page = pageBegin; page != pageEnd; page += pageStep) {
+        uint8_t mask = 0xFF;
+        if (page == firstPage) mask &= kPageTopMask[y & 7];
+        if (page == lastPage) mask &= kPageBottomMask[(y + h - 1) & 7];
+        const uint8_t keep = static_cast<uint8_t>(~mask);
+        uint8_t* row = pageRow(page);
+
+        if (dy == 0) {
+            if (mask == 0xFF) {
+                memmove(row + colFirst, row + colFirst - dx, static_cast<size_t>(cols));
+            } else if (dx > 0) {
+                for (int col = colLast; col >= colFirst; --col) {
+                    row[col] = static_cast<uint8_t>((row[col] & keep) | (row[col - dx] & mask));
+                }
+            } else {
+                for (int col = colFirst; col <= colLast; ++col) {
+                    row[col] = static_cast<uint8_t>((row[col] & keep) | (row[col - dx] & mask));
+                }
+            }
+            continue;
+        }
+
+        // Строка источника для бита 0: байт склеивается из страниц srcPage и srcPage + 1.
+        // Строки вне области попадают только в открывшуюся полосу - её зальёт fillArea
+        const int srcRow = page * 8 - dy;
+        const int srcPage = (srcRow >= 0) ? srcRow / 8 : -((7 - srcRow) / 8);
+        const int shift = srcRow - srcPage * 8;
+        const uint8_t* lo = (srcPage >= 0 && srcPage < pages) ? pageRow(srcPage) : nullptr;
+        const uint8_t* hi = (srcPage + 1 >= 0 && srcPage + 1 < pages) ? pageRow(srcPage + 1) : nullptr;
+
+        const int colBegin = (dx > 0) ? colLast : colFirst;
+        const int colEnd = (dx > 0) ? colFirst - 1 : colLast + 1;
+        const int colStep = (dx > 0) ? -1 : 1;
+        for (int col = colBegin; col != colEnd; col += colStep) {
+            const int srcCol = col - dx;
+            const uint16_t pair = static_cast<uint16_t>((hi ? hi[srcCol] << 8 : 0) | (lo ? lo[srcCol] : 0));
+            const uint8_t v = static_cast<uint8_t>(pair >> shift);
+            row[col] = static_cast<uint8_t>((row[col] & keep) | (v & mask));
+        }
+    }
+
+    // Открывшиеся полосы
+    if (dx > 0) {
+        fillArea(x, y, dx, h, fill);
+    } else if (dx < 0) {
+        fillArea(x + w + dx, y, -dx, h, fill);
+    }
+    if (dy > 0) {
+        fillArea(x, y, w, dy, fill);
+    } else if (dy < 0) {
+        fillArea(x, y + h + dy, w, -dy, fill);
+    }
+}
+
+void Gfx::blitClipped(int dx, int dy, int w, int h, const uint8_t* src, size_t srcStride,
+                      int srcPages, int sx, int sy, RasterOp op) {
+    BlitJob job;
+    job.dst = buffer_;
+    job.dstStride = width_;
+    job.dstPages = height_ >> 3;
+    job.dstOrigin = ringOrigin_;
+    job.src = src;
+    job.srcStride = srcStride;
+    job.srcPages = srcPages;
+    job.srcOrigin = (src == buffer_) ? ringOrigin_ : 0;
+    job.dx0 = dx;
+    job.dx1 = dx + w;
+    job.dy0 = dy;
+    job.dy1 = dy + h;
+    job.colOffset = sx - dx;
+    job.rowOffset = sy - dy;
+
+    markDirtyClipped(job.dx0, job.dx1 - 1, job.dy0 >> 3, (job.dy1 - 1) >> 3);
+
+    switch (op) {
+        case RasterOp::Copy:   runBlit<RasterOp::Copy>(job);   break;
+        case RasterOp::Or:     runBlit<RasterOp::Or>(job);     break;
+        case RasterOp::And:    runBlit<RasterOp::And>(job);    break;
+        case RasterOp::Xor:    runBlit<RasterOp::Xor>(job);    break;
+        case RasterOp::AndNot: runBlit<RasterOp::AndNot>(job); break;
+        case RasterOp::Not:    runBlit<RasterOp::Not>(job);    break;
     }
 }
 
 void Gfx::setCursor(int x, int y) {
     cursorX_ = x;
     cursorY_ = y;
+    prevGlyph_ = nullptr;
 }
 
 void Gfx::setTextSize(uint8_t scale) {
@@ -126,120 +1256,312 @@ void Gfx::setTextColor(bool color) {
     textColor_ = color;
 }
 
+void Gfx::drawTextRotated(int x, int y, const char* str, Rotation rotation) {
+    if (!str) return;
+
+    // Ячейка символа 6x8 (глиф + колонка интервала), после поворота на 90/270 - 8x6
+    constexpr int kCell = FONT_WIDTH + 1;
+    const bool sideways = (rotation == Rotation::R90 || rotation == Rotation::R270);
+    const int cellW = sideways ? 8 : kCell;
+    const int cellH = sideways ? kCell : 8;
+    const RasterOp op = textColor_ ? RasterOp::Or : RasterOp::AndNot;
+
+    while (*str) {
+        uint32_t codepoint;
+        int len = decodeUtf8(str, codepoint);
+        if (len == 0) {
+            str++;
+            continue;
+        }
+        str += len;
+
+        const uint8_t* glyph = findGlyph5x7(codepoint);
+        if (glyph) {
+            // Ячейка как матрица 8x8: колонки глифа, бит = строка
+            uint8_t cell[8] = {0};
+            uint8_t bits[8];
+            switch (rotation) {
+                case Rotation::R90:
+                    // По часовой: строка глифа y -> колонка 7 - y
+                    memcpy(cell, glyph, FONT_WIDTH);
+                    FrameRotate::transpose8x8(cell, bits);
+                    std::reverse(bits, bits + 8);
+                    break;
+                case Rotation::R270:
+                    // Против часовой: колонка глифа x -> строка kCell - 1 - x
+                    for (int col = 0; col < FONT_WIDTH; ++col) {
+                        cell[kCell - 1 - col] = glyph[col];
+                    }
+                    FrameRotate::transpose8x8(cell, bits);
+                    break;
+                case Rotation::R180:
+                    // Колонки в обратном порядке, биты колонки перевёрнуты
+                    for (int col = 0; col < FONT_WIDTH; ++col) {
+                        uint8_t v = glyph[col];
+                        uint8_t r = 0;
+                        for (int b = 0; b < 8; ++b) {
+                            r = static_cast<uint8_t>((r << 1) | ((v >> b) & 1));
+                        }
+                        bits[kCell - 1 - col] = r;
+                    }
+                    bits[0] = 0;
+                    break;
+                case Rotation::R0:
+                default:
+                    memcpy(bits, glyph, FONT_WIDTH);
+                    bits[FONT_WIDTH] = 0;
+                    break;
+            }
+            blit(x, y, cellW, cellH, bits, op);
+        }
+
+        switch (rotation) {
+            case Rotation::R90:  y += kCell; break;
+            case Rotation::R180: x -= kCell; break;
+            case Rotation::R270: y -= kCell; break;
+            case Rotation::R0:
+            default:             x += kCell; break;
+        }
+    }
+}
+
 void Gfx::drawChar(int x, int y, char c, bool color, uint8_t scale) {
     // Проверка диапазона символа
     if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR) {
         c = ' '; // Заменяем неизвестные символы пробелом
     }
 
-    // Индекс в таблице шрифта
-    size_t charIdx = static_cast<size_t>(c - FONT_FIRST_CHAR) * FONT_WIDTH;
+    drawGlyph(x, y, static_cast<uint8_t>(c), color, scale);
+}
 
-    // Рисуем каждую колонку символа
-    for (uint8_t col = 0; col < FONT_WIDTH; ++col) {
-        uint8_t colData = FONT_5X7[charIdx + col];
+void Gfx::blitColumn(int x, int y, uint32_t bits, uint8_t height, bool color) {
+    if (!buffer_ || bits == 0 || x < 0 || x >= width_) {
+        return;
+    }
 
-        // Рисуем каждый бит (строку)
-        for (uint8_t row = 0; row < FONT_HEIGHT; ++row) {
-            bool pixelOn = (colData >> row) & 0x01;
-
-            // Если пиксель включён (или инверсия для фона)
-            if (pixelOn) {
-                // С учётом масштаба
-                for (uint8_t sy = 0; sy < scale; ++sy) {
-                    for (uint8_t sx = 0; sx < scale; ++sx) {
-                        pixel(x + col * scale + sx, y + row * scale + sy, color);
-                    }
-                }
-            }
+    // Вертикальная обрезка: сдвигаем биты, а не проверяем каждый пиксель
+    if (y < 0) {
+        if (-y >= height) return;
+        bits >>= -y;
+        height = static_cast<uint8_t>(height + y);
+        y = 0;
+    }
+    if (y >= height_) {
+        return;
+    }
+    if (height > height_ - y) {
+        height = static_cast<uint8_t>(height_ - y);
+    }
+    if (height < 32) {
+        bits &= (1UL << height) - 1;
+    }
+    if (bits == 0) {
+        return;
+    }
+
+    int page = y >> 3;
+    const int lastPage = (y + height - 1) >> 3;
+    const uint8_t shift = y & 7;
+    markDirtyClipped(x, x, page, lastPage);
+
+    // Первый байт - младшие биты со сдвигом, остаток переходит на следующие страницы
+    uint8_t* dst = pageRow(page) + x;
+    uint8_t b = static_cast<uint8_t>(bits << shift);
+    bits >>= (8 - shift);
+
+    while (true) {
+        if (color) {
+            *dst |= b;
+        } else {
+            *dst &= static_cast<uint8_t>(~b);
         }
+        if (++page > lastPage) {
+            break;
+        }
+        dst = pageRow(page) + x;
+        b = static_cast<uint8_t>(bits);
+        bits >>= 8;
     }
 }
 
-int Gfx::decodeUtf8(const char* str, uint16_t& codepoint) {
+int Gfx::decodeUtf8(const char* str, uint32_t& codepoint) {
     if (!str || !*str) {
         codepoint = 0;
         return 0;
     }
 
-    uint8_t b0 = static_cast<uint8_t>(str[0]);
+    const uint8_t b0 = static_cast<uint8_t>(str[0]);
 
     // ASCII (0xxxxxxx)
-    if ((b0 & 0x80) == 0) {
+    if (b0 < 0x80) {
         codepoint = b0;
         return 1;
     }
 
-    // 2-байтовая последовательность (110xxxxx 10xxxxxx)
-    if ((b0 & 0xE0) == 0xC0) {
-        if (!str[1]) return 0;
-        uint8_t b1 = static_cast<uint8_t>(str[1]);
-        if ((b1 & 0xC0) != 0x80) return 0;
+    // Длина и допустимый диапазон второго байта по ведущему (RFC 3629):
+    // C0/C1 и E0 80..9F, F0 80..8F - overlong, ED A0..BF - суррогаты,
+    // F4 90.. и F5..FF - больше U+10FFFF
+    int len;
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+    if (b0 >= 0xC2 && b0 <= 0xDF) {
+        len = 2;
+        codepoint = b0 & 0x1F;
+    } else if (b0 >= 0xE0 && b0 <= 0xEF) {
+        len = 3;
+        codepoint = b0 & 0x0F;
+        if (b0 == 0xE0) lo = 0xA0;
+        if (b0 == 0xED) hi = 0x9F;
+    } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+        len = 4;
+        codepoint = b0 & 0x07;
+        if (b0 == 0xF0) lo = 0x90;
+        if (b0 == 0xF4) hi = 0x8F;
+    } else {
+        // Продолжение без ведущего байта или недопустимый ведущий байт
+        codepoint = 0;
+        return 0;
+    }
+
+    for (int i = 1; i < len; ++i) {
+        const uint8_t b = static_cast<uint8_t>(str[i]);  // '\0' не пройдёт проверку
+        if (b < lo || b > hi) {
+            codepoint = 0;
+            return 0;
+        }
+        codepoint = (codepoint << 6) | (b & 0x3F);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    return len;
+}
+
+void Gfx::drawGlyph(int x, int y, uint32_t codepoint, bool color, uint8_t scale) {
+    // ASCII напрямую, остальное - двоичный поиск по таблице диапазонов
+    drawGlyph5x7(x, y, findGlyph5x7(codepoint), color, scale);
+}
 
-        codepoint = ((b0 & 0x1F) << 6) | (b1 & 0x3F);
-        return 2;
+void Gfx::drawGlyph5x7(int x, int y, const uint8_t* glyph, bool color, uint8_t scale) {
+    // Если глиф не найден - рисуем пробел
+    if (!glyph) {
+        return;
+    }
+
+    // Колонка шрифта уже в формате страницы: один байт (или два при y % 8 != 0).
+    // Для scale 2..4 колонка растягивается по таблице и повторяется scale раз по X
+    if (scale <= kMaxLutScale) {
+        const uint8_t colHeight = static_cast<uint8_t>(FONT_HEIGHT * scale);
+        for (uint8_t col = 0; col < FONT_WIDTH; ++col) {
+            const uint32_t bits = spreadColumn(glyph[col] & 0x7F, scale);
+            if (bits == 0) {
+                continue;
+            }
+            const int colX = x + col * scale;
+            for (uint8_t sx = 0; sx < scale; ++sx) {
+                blitColumn(colX + sx, y, bits, colHeight, color);
+            }
+        }
+        return;
     }
 
-    // 3-байтовая последовательность (1110xxxx 10xxxxxx 10xxxxxx)
-    if ((b0 & 0xF0) == 0xE0) {
-        if (!str[1] || !str[2]) return 0;
-        uint8_t b1 = static_cast<uint8_t>(str[1]);
-        uint8_t b2 = static_cast<uint8_t>(str[2]);
-        if ((b1 & 0xC0) != 0x80 || (b2 & 0xC0) != 0x80) return 0;
+    // Крупнее таблиц: каждый включённый пиксель - блок scale x scale
+    for (uint8_t col = 0; col < FONT_WIDTH; ++col) {
+        uint8_t colData = glyph[col];
 
-        codepoint = ((b0 & 0x0F) << 12) | ((b1 & 0x3F) << 6) | (b2 & 0x3F);
-        return 3;
+        for (uint8_t row = 0; row < FONT_HEIGHT; ++row) {
+            if ((colData >> row) & 0x01) {
+                fillArea(x + col * scale, y + row * scale, scale, scale, color);
+            }
+        }
     }
+}
 
-    // 4-байтовая последовательность - не поддерживаем (codepoint > 16 бит)
-    // Пропускаем как ошибку
-    codepoint = '?';
-    return 1;
+void Gfx::setFont(const Font* font) {
+    font_ = font;
+    prevGlyph_ = nullptr;
 }
 
-void Gfx::drawGlyph(int x, int y, uint16_t codepoint, bool color, uint8_t scale) {
-    const uint8_t* glyph = nullptr;
+int Gfx::lineHeight() const {
+    return font_ ? font_->lineHeight : (FONT_HEIGHT + 1) * textScale_;
+}
 
-    // ASCII символы
-    if (codepoint >= FONT_FIRST_CHAR && codepoint <= FONT_LAST_CHAR) {
-        size_t charIdx = static_cast<size_t>(codepoint - FONT_FIRST_CHAR) * FONT_WIDTH;
-        glyph = &FONT_5X7[charIdx];
+void Gfx::drawFontGlyph(const Font& font, int x, int y, const FontGlyph& glyph, bool color) {
+    if (glyph.height == 0 || glyph.height > 32) {
+        return;
     }
-    // Кириллица
-    else {
-        glyph = getCyrillicGlyph(codepoint);
+
+    GlyphColumnReader reader(font.bitmap + glyph.offset, font.encoding);
+    const int x0 = x + glyph.xOffset;
+    const int y0 = y + glyph.yOffset;
+    for (uint8_t col = 0; col < glyph.width; ++col) {
+        blitColumn(x0 + col, y0, reader.next(glyph.height), glyph.height, color);
     }
+}
 
-    // Если глиф не найден - рисуем пробел
+void Gfx::printFontChar(uint32_t codepoint) {
+    const FontGlyph* glyph = glyphOrFallback(*font_, codepoint);
     if (!glyph) {
         return;
     }
 
-    // Рисуем каждую колонку символа
-    for (uint8_t col = 0; col < FONT_WIDTH; ++col) {
-        uint8_t colData = glyph[col];
+    cursorX_ += font_->kern(prevGlyph_, glyph);
 
-        // Рисуем каждый бит (строку)
-        for (uint8_t row = 0; row < FONT_HEIGHT; ++row) {
-            bool pixelOn = (colData >> row) & 0x01;
+    // Перенос до отрисовки: ширина следующего глифа известна заранее
+    if (cursorX_ > 0 && cursorX_ + glyph->advance > static_cast<int>(width_)) {
+        cursorX_ = 0;
+        cursorY_ += font_->lineHeight;
+    }
 
-            if (pixelOn) {
-                // С учётом масштаба
-                for (uint8_t sy = 0; sy < scale; ++sy) {
-                    for (uint8_t sx = 0; sx < scale; ++sx) {
-                        pixel(x + col * scale + sx, y + row * scale + sy, color);
-                    }
-                }
-            }
+    drawFontGlyph(*font_, cursorX_, cursorY_, *glyph, textColor_);
+    cursorX_ += glyph->advance;
+    prevGlyph_ = glyph;
+}
+
+void Gfx::printGlyph5x7(const uint8_t* glyph) {
+    drawGlyph5x7(cursorX_, cursorY_, glyph, textColor_, textScale_);
+
+    // Сдвигаем курсор (ширина символа + 1 пиксель межбуквенный интервал)
+    cursorX_ += (FONT_WIDTH + 1) * textScale_;
+
+    // Автоперенос на следующую строку
+    if (cursorX_ + static_cast<int>(FONT_WIDTH * textScale_) > static_cast<int>(width_)) {
+        cursorX_ = 0;
+        cursorY_ += (FONT_HEIGHT + 1) * textScale_;
+    }
+}
+
+void Gfx::printAscii(const char* str, size_t len) {
+    if (font_) {
+        for (size_t i = 0; i < len; ++i) {
+            printFontChar(static_cast<uint8_t>(str[i]));
         }
+        return;
+    }
+
+    // Глиф берётся из таблицы ASCII напрямую, без декодера и поиска диапазона
+    for (size_t i = 0; i < len; ++i) {
+        const uint8_t c = static_cast<uint8_t>(str[i]);
+        const uint8_t* glyph = (c <= static_cast<uint8_t>(FONT_LAST_CHAR))
+                                   ? &FONT_5X7[(c - FONT_FIRST_CHAR) * FONT_WIDTH] : nullptr;
+        printGlyph5x7(glyph);
     }
 }
 
 void Gfx::print(const char* str) {
     if (!str) return;
 
-    while (*str) {
-        uint16_t codepoint;
+    const char* end = str + strlen(str);
+
+    while (str < end) {
+        // Пачка печатных ASCII символов - мимо декодера UTF-8
+        size_t run = asciiRunLength(str, static_cast<size_t>(end - str));
+        if (run > 0) {
+            printAscii(str, run);
+            str += run;
+            continue;
+        }
+
+        uint32_t codepoint;
         int len = decodeUtf8(str, codepoint);
 
         if (len == 0) {
@@ -253,26 +1575,236 @@ void Gfx::print(const char* str) {
         // Перенос строки
         if (codepoint == '\n') {
             cursorX_ = 0;
-            cursorY_ += (FONT_HEIGHT + 1) * textScale_;
+            cursorY_ += lineHeight();
+            prevGlyph_ = nullptr;
             continue;
         }
 
         // Возврат каретки
         if (codepoint == '\r') {
             cursorX_ = 0;
+            prevGlyph_ = nullptr;
             continue;
         }
 
-        // Рисуем символ
-        drawGlyph(cursorX_, cursorY_, codepoint, textColor_, textScale_);
+        // Пропорциональный шрифт: собственные метрики и кернинг
+        if (font_) {
+            printFontChar(codepoint);
+            continue;
+        }
 
-        // Сдвигаем курсор (ширина символа + 1 пиксель межбуквенный интервал)
-        cursorX_ += (FONT_WIDTH + 1) * textScale_;
+        printGlyph5x7(findGlyph5x7(codepoint));
+    }
+}
 
-        // Автоперенос на следующую строку
-        if (cursorX_ + static_cast<int>(FONT_WIDTH * textScale_) > static_cast<int>(width_)) {
-            cursorX_ = 0;
-            cursorY_ += (FONT_HEIGHT + 1) * textScale_;
+Gfx::LineBreak Gfx::breakLine(const char* str, int maxWidth) const {
+    TextPen pen(font_, textScale_);
+    const char* p = str;
+    int penX = 0;
+    int width = 0;
+
+    // Последний пробел: строку можно закончить перед ним
+    const char* spaceEnd = nullptr;
+    const char* spaceNext = nullptr;
+    int spaceWidth = 0;
+
+    while (*p) {
+        uint32_t codepoint;
+        int len = decodeUtf8(p, codepoint);
+        if (len == 0) {
+            ++p;
+            continue;
+        }
+        if (codepoint == '\n') {
+            return {p, p + len, width};
+        }
+        if (codepoint == '\r') {
+            p += len;
+            continue;
+        }
+
+        int ink;
+        const int advance = pen.step(codepoint, ink);
+
+        if (codepoint == ' ') {
+            spaceEnd = p;
+            spaceNext = p + len;
+            spaceWidth = width;
+        } else {
+            if (maxWidth > 0 && p != str && penX + ink > maxWidth) {
+                if (spaceEnd) {
+                    // Перенос по слову: пробелы на месте переноса не переходят на новую строку
+                    while (*spaceNext == ' ') {
+                        ++spaceNext;
+                    }
+                    return {spaceEnd, spaceNext, spaceWidth};
+                }
+                // Слово шире строки - перенос по символу
+                return {p, p, width};
+            }
+            width = std::max(width, penX + ink);
+        }
+
+        penX += advance;
+        p += len;
+    }
+    return {p, p, width};
+}
+
+Gfx::LineBreak Gfx::ellipsizeLine(const char* str, int maxWidth) const {
+    // Ширина "..." отдельно от текста (без кернинга с последним символом)
+    TextPen dots(font_, textScale_);
+    int ellipsisWidth = 0;
+    int dotX = 0;
+    for (const char* d = kEllipsis; *d; ++d) {
+        int ink;
+        const int advance = dots.step(static_cast<uint8_t>(*d), ink);
+        ellipsisWidth = std::max(ellipsisWidth, dotX + ink);
+        dotX += advance;
+    }
+
+    TextPen pen(font_, textScale_);
+    const char* p = str;
+    const char* keepEnd = str;
+    int penX = 0;
+    int keepX = 0;
+
+    while (*p) {
+        uint32_t codepoint;
+        int len = decodeUtf8(p, codepoint);
+        if (len == 0) {
+            ++p;
+            continue;
+        }
+        if (codepoint == '\n') {
+            break;
+        }
+        if (codepoint == '\r') {
+            p += len;
+            continue;
+        }
+
+        int ink;
+        const int advance = pen.step(codepoint, ink);
+        if (maxWidth > 0 && penX + advance + ellipsisWidth > maxWidth) {
+            break;
+        }
+        penX += advance;
+        p += len;
+        if (codepoint != ' ') {
+            keepEnd = p;
+            keepX = penX;
+        }
+    }
+    return {keepEnd, p, keepX + ellipsisWidth};
+}
+
+int Gfx::measureText(const char* str) const {
+    if (!str) return 0;
+
+    int width = 0;
+    while (*str) {
+        LineBreak br = breakLine(str, 0);
+        width = std::max(width, br.width);
+        str = br.next;
+    }
+    return width;
+}
+
+void Gfx::layoutText(TextLayout& layout, const char* str, int maxWidth, TextAlign align,
+                     uint8_t maxLines) const {
+    layout = TextLayout();
+    layout.text_ = str;
+    layout.font_ = font_;
+    layout.scale_ = textScale_;
+    layout.lineHeight_ = static_cast<int16_t>(lineHeight());
+    if (!str) return;
+
+    const uint8_t limit = (maxLines == 0 || maxLines > TextLayout::MAX_LINES)
+                              ? TextLayout::MAX_LINES : maxLines;
+    const char* p = str;
+
+    while (*p && layout.lineCount_ < limit) {
+        LineBreak br = breakLine(p, maxWidth);
+
+        // Последняя доступная строка, а текст не кончился - многоточие
+        if (layout.lineCount_ + 1 == limit && *br.next) {
+            br = ellipsizeLine(p, maxWidth);
+            layout.truncated_ = true;
+        }
+
+        TextLine& line = layout.lines_[layout.lineCount_++];
+        line.start = static_cast<uint16_t>(p - str);
+        line.length = static_cast<uint16_t>(br.end - p);
+        line.width = static_cast<int16_t>(br.width);
+        layout.width_ = std::max<int16_t>(layout.width_, line.width);
+        p = br.next;
+    }
+
+    // Выравнивание внутри maxWidth (без ограничения - внутри самой широкой строки)
+    const int boxWidth = maxWidth > 0 ? maxWidth : layout.width_;
+    int left = boxWidth;
+    int right = 0;
+    for (uint8_t i = 0; i < layout.lineCount_; ++i) {
+        TextLine& line = layout.lines_[i];
+        int x = 0;
+        if (align == TextAlign::Center) {
+            x = (boxWidth - line.width) / 2;
+        } else if (align == TextAlign::Right) {
+            x = boxWidth - line.width;
+        }
+        line.x = static_cast<int16_t>(x);
+        left = std::min(left, x);
+        right = std::max(right, x + line.width);
+    }
+    layout.left_ = static_cast<int16_t>(layout.lineCount_ ? left : 0);
+    layout.width_ = static_cast<int16_t>(layout.lineCount_ ? right - left : 0);
+}
+
+int Gfx::drawTextRun(const TextLayout& layout, int x, int y, const char* str, const char* end) {
+    const FontGlyph* prev = nullptr;
+
+    while (str < end) {
+        uint32_t codepoint;
+        int len = decodeUtf8(str, codepoint);
+        if (len == 0) {
+            ++str;
+            continue;
+        }
+        str += len;
+        if (codepoint == '\r') {
+            continue;
+        }
+
+        if (!layout.font_) {
+            drawGlyph(x, y, codepoint, textColor_, layout.scale_);
+            x += (FONT_WIDTH + 1) * layout.scale_;
+            continue;
+        }
+
+        const FontGlyph* glyph = glyphOrFallback(*layout.font_, codepoint);
+        if (!glyph) {
+            continue;
+        }
+        x += layout.font_->kern(prev, glyph);
+        drawFontGlyph(*layout.font_, x, y, *glyph, textColor_);
+        x += glyph->advance;
+        prev = glyph;
+    }
+    return x;
+}
+
+void Gfx::drawText(const TextLayout& layout, int x, int y) {
+    if (!buffer_ || !layout.text_) return;
+
+    for (uint8_t i = 0; i < layout.lineCount_; ++i) {
+        const TextLine& line = layout.lines_[i];
+        const char* start = layout.text_ + line.start;
+        const int lineY = y + i * layout.lineHeight_;
+
+        int penX = drawTextRun(layout, x + line.x, lineY, start, start + line.length);
+        if (layout.truncated_ && i + 1 == layout.lineCount_) {
+            drawTextRun(layout, penX, lineY, kEllipsis, kEllipsis + sizeof(kEllipsis) - 1);
         }
     }
 }
@@ -0,0 +1,178 @@
+/**
+ * @file GlyphIndex5x7.hpp
+ * @brief Таблица диапазонов Unicode для шрифта 5x7
+ *
+ * Отсортированные по codepoint диапазоны указывают на банк глифов и индекс
+ * первого глифа в нём. Поиск - двоичный, O(log диапазонов): новые блоки
+ * добавляются строкой в таблицу, без новых ветвлений в коде отрисовки.
+ * Codepoint - полные 21 бит (включая U+1xxxx).
+ */
+
+#ifndef OLED_GLYPH_INDEX_5X7_HPP
+#define OLED_GLYPH_INDEX_5X7_HPP
+
+#include "Font5x7.hpp"
+#include "FontCyrillic5x7.hpp"
+#include "FontUnicode5x7.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace oled {
+
+// Банки глифов (индекс в GLYPH_BANKS_5X7)
+enum GlyphBank5x7 : uint8_t {
+    BANK_ASCII,
+    BANK_LATIN1,
+    BANK_GREEK,
+    BANK_CYRILLIC_YO_UPPER,
+    BANK_CYRILLIC_UPPER,
+    BANK_CYRILLIC_LOWER,
+    BANK_CYRILLIC_YO_LOWER,
+    BANK_CYRILLIC_EXT,
+    BANK_BOX_DRAWING,
+    BANK_ICONS,
+};
+
+constexpr const uint8_t* GLYPH_BANKS_5X7[] = {
+    FONT_5X7,
+    FONT_LATIN1_SUPPLEMENT,
+    FONT_GREEK,
+    FONT_CYRILLIC_YO_UPPER,
+    FONT_CYRILLIC_UPPER,
+    FONT_CYRILLIC_LOWER,
+    FONT_CYRILLIC_YO_LOWER,
+    FONT_CYRILLIC_EXT,
+    FONT_BOX_DRAWING,
+    FONT_ICONS,
+};
+
+// Количество глифов в каждом банке
+constexpr uint16_t GLYPH_BANK_SIZES_5X7[] = {
+    sizeof(FONT_5X7) / FONT_WIDTH,
+    sizeof(FONT_LATIN1_SUPPLEMENT) / FONT_WIDTH,
+    sizeof(FONT_GREEK) / FONT_WIDTH,
+    sizeof(FONT_CYRILLIC_YO_UPPER) / FONT_WIDTH,
+    sizeof(FONT_CYRILLIC_UPPER) / FONT_WIDTH,
+    sizeof(FONT_CYRILLIC_LOWER) / FONT_WIDTH,
+    sizeof(FONT_CYRILLIC_YO_LOWER) / FONT_WIDTH,
+    sizeof(FONT_CYRILLIC_EXT) / FONT_WIDTH,
+    sizeof(FONT_BOX_DRAWING) / FONT_WIDTH,
+    sizeof(FONT_ICONS) / FONT_WIDTH,
+};
+
+/**
+ * @brief Диапазон codepoint: first .. first + count - 1 -> глифы base .. base + count - 1
+ */
+struct GlyphRange {
+    uint32_t first;  // Первый codepoint
+    uint16_t count;  // Количество codepoint
+    uint8_t  base;   // Индекс первого глифа в банке
+    uint8_t  bank;   // GlyphBank5x7
+};
+
+// Отсортировано по first, диапазоны не пересекаются
+constexpr GlyphRange GLYPH_RANGES_5X7[] = {
+    {0x0020,  95, 0,  BANK_ASCII},              // ASCII
+    {0x00A0,  96, 0,  BANK_LATIN1},             // Latin-1 Supplement
+    {0x0391,  17, 0,  BANK_GREEK},              // Α-Ρ
+    {0x03A3,   7, 17, BANK_GREEK},              // Σ-Ω
+    {0x03B1,  25, 24, BANK_GREEK},              // α-ω
+    {0x0401,   1, 0,  BANK_CYRILLIC_YO_UPPER},  // Ё
+    {0x0404,   1, 0,  BANK_CYRILLIC_EXT},       // Є
+    {0x0406,   2, 1,  BANK_CYRILLIC_EXT},       // І Ї
+    {0x040E,   1, 3,  BANK_CYRILLIC_EXT},       // Ў
+    {0x0410,  32, 0,  BANK_CYRILLIC_UPPER},     // А-Я
+    {0x0430,  32, 0,  BANK_CYRILLIC_LOWER},     // а-я
+    {0x0451,   1, 0,  BANK_CYRILLIC_YO_LOWER},  // ё
+    {0x0454,   1, 4,  BANK_CYRILLIC_EXT},       // є
+    {0x0456,   2, 5,  BANK_CYRILLIC_EXT},       // і ї
+    {0x045E,   1, 7,  BANK_CYRILLIC_EXT},       // ў
+    {0x0490,   2, 8,  BANK_CYRILLIC_EXT},       // Ґ ґ
+    {0x2190,   4, 12, BANK_ICONS},              // ← ↑ → ↓
+    {0x2500,   1, 0,  BANK_BOX_DRAWING},        // ─
+    {0x2502,   1, 1,  BANK_BOX_DRAWING},        // │
+    {0x250C,   1, 2,  BANK_BOX_DRAWING},        // ┌
+    {0x2510,   1, 3,  BANK_BOX_DRAWING},        // ┐
+    {0x2514,   1, 4,  BANK_BOX_DRAWING},        // └
+    {0x2518,   1, 5,  BANK_BOX_DRAWING},        // ┘
+    {0x251C,   1, 6,  BANK_BOX_DRAWING},        // ├
+    {0x2524,   1, 7,  BANK_BOX_DRAWING},        // ┤
+    {0x252C,   1, 8,  BANK_BOX_DRAWING},        // ┬
+    {0x2534,   1, 9,  BANK_BOX_DRAWING},        // ┴
+    {0x253C,   1, 10, BANK_BOX_DRAWING},        // ┼
+    {0x2550,   2, 11, BANK_BOX_DRAWING},        // ═ ║
+    {0x2554,   1, 13, BANK_BOX_DRAWING},        // ╔
+    {0x2557,   1, 14, BANK_BOX_DRAWING},        // ╗
+    {0x255A,   1, 15, BANK_BOX_DRAWING},        // ╚
+    {0x255D,   1, 16, BANK_BOX_DRAWING},        // ╝
+    {0x2580,   1, 17, BANK_BOX_DRAWING},        // ▀
+    {0x2584,   1, 18, BANK_BOX_DRAWING},        // ▄
+    {0x2588,   1, 19, BANK_BOX_DRAWING},        // █
+    {0x258C,   1, 20, BANK_BOX_DRAWING},        // ▌
+    {0x2590,   4, 21, BANK_BOX_DRAWING},        // ▐ ░ ▒ ▓
+    {0x2665,   1, 10, BANK_ICONS},              // ♥
+    {0x26A0,   1, 9,  BANK_ICONS},              // ⚠
+    {0x2713,   1, 7,  BANK_ICONS},              // ✓
+    {0x2717,   1, 8,  BANK_ICONS},              // ✗
+    {0xE000,  16, 0,  BANK_ICONS},              // Иконки (Private Use Area)
+    {0x1F321,  1, 11, BANK_ICONS},              // 🌡
+    {0x1F4F6,  1, 3,  BANK_ICONS},              // 📶
+    {0x1F50B,  1, 2,  BANK_ICONS},              // 🔋
+    {0x1F512,  1, 6,  BANK_ICONS},              // 🔒
+    {0x1F514,  1, 5,  BANK_ICONS},              // 🔔
+};
+
+constexpr size_t GLYPH_RANGE_COUNT_5X7 = sizeof(GLYPH_RANGES_5X7) / sizeof(GLYPH_RANGES_5X7[0]);
+
+namespace detail {
+    // Диапазоны отсортированы, не пересекаются и не выходят за свой банк
+    constexpr bool glyphRangesValid(size_t i = 0) {
+        return i >= GLYPH_RANGE_COUNT_5X7 ||
+               ((i == 0 || GLYPH_RANGES_5X7[i - 1].first + GLYPH_RANGES_5X7[i - 1].count <=
+                               GLYPH_RANGES_5X7[i].first) &&
+                GLYPH_RANGES_5X7[i].base + GLYPH_RANGES_5X7[i].count <=
+                    GLYPH_BANK_SIZES_5X7[GLYPH_RANGES_5X7[i].bank] &&
+                glyphRangesValid(i + 1));
+    }
+}
+
+static_assert(detail::glyphRangesValid(), "GLYPH_RANGES_5X7 must be sorted, disjoint and within banks");
+
+/**
+ * @brief Найти глиф 5x7 по Unicode codepoint
+ * @param codepoint Unicode codepoint (до U+10FFFF)
+ * @return Указатель на 5-байтовый массив глифа или nullptr
+ */
+inline const uint8_t* findGlyph5x7(uint32_t codepoint) {
+    // ASCII без поиска - самый частый случай
+    const uint32_t asciiIndex = codepoint - static_cast<uint32_t>(FONT_FIRST_CHAR);
+    if (asciiIndex <= static_cast<uint32_t>(FONT_LAST_CHAR - FONT_FIRST_CHAR)) {
+        return &FONT_5X7[asciiIndex * FONT_WIDTH];
+    }
+
+    // Последний диапазон с first <= codepoint
+    size_t lo = 0;
+    size_t hi = GLYPH_RANGE_COUNT_5X7;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (GLYPH_RANGES_5X7[mid].first <= codepoint) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0) {
+        return nullptr;
+    }
+
+    const GlyphRange& range = GLYPH_RANGES_5X7[lo - 1];
+    uint32_t index = codepoint - range.first;
+    if (index >= range.count) {
+        return nullptr;
+    }
+    return GLYPH_BANKS_5X7[range.bank] + (range.base + index) * FONT_WIDTH;
+}
+
+} // namespace oled
+
+#endif // OLED_GLYPH_INDEX_5X7_HPP
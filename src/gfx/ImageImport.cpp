@@ -0,0 +1,606 @@
+/**
+ * @file ImageImport.cpp
+ * @brief Потоковая загрузка PBM/XBM/BMP с транспонированием блоками 8x8
+ */
+
+#include "../../include/oled/domain/ImageImport.hpp"
+#include "../../include/oled/domain/Bitmap.hpp"
+#include "../../include/oled/domain/FrameRotate.hpp"
+
+#if OLED_ENABLED
+
+#include <cstring>
+
+namespace oled {
+
+namespace {
+    constexpr size_t kReadChunk = 32;
+    // +1: видимые колонки могут начинаться с середины байта
+    constexpr size_t kStripBytes = ImageImport::MAX_STRIP_WIDTH / 8 + 1;
+    constexpr uint32_t kMaxDimension = 0xFFFF;
+    constexpr uint16_t kBmpMagic = 0x4D42;          // "BM"
+    constexpr uint32_t kBmpCoreHeaderSize = 12;     // BITMAPCOREHEADER (OS/2)
+    constexpr uint32_t kBmpInfoHeaderSize = 40;     // BITMAPINFOHEADER и старше
+    constexpr uint32_t kBmpInfoFieldsRead = 20;     // Размер заголовка .. compression
+
+    /**
+     * @brief Буферизованное чтение по одному байту
+     */
+    class ByteStream {
+    public:
+        explicit ByteStream(IByteReader& reader) : reader_(reader) {}
+
+        // -1 в конце данных
+        int peek() {
+            if (pos_ == len_) {
+                len_ = reader_.read(buf_, sizeof(buf_));
+                pos_ = 0;
+                if (len_ == 0) {
+                    return -1;
+                }
+            }
+            return buf_[pos_];
+        }
+
+        int get() {
+            const int c = peek();
+            if (c >= 0) {
+                ++pos_;
+                ++consumed_;
+            }
+            return c;
+        }
+
+        bool skip(uint32_t count) {
+            for (; count > 0; --count) {
+                if (get() < 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        uint32_t consumed() const { return consumed_; }
+
+    private:
+        IByteReader& reader_;
+        uint8_t buf_[kReadChunk];
+        size_t pos_ = 0;
+        size_t len_ = 0;
+        uint32_t consumed_ = 0;
+    };
+
+    enum class Encoding : uint8_t {
+        Binary,    // P4, BMP: байт файла = 8 пикселей
+        PbmAscii,  // P1: символ '0'/'1' на пиксель
+        XbmHex     // XBM: числа 0xNN через запятую
+    };
+
+    struct ImageHeader {
+        ImageInfo info;
+        Encoding encoding = Encoding::Binary;
+        BitOrder order = BitOrder::MsbFirst;
+        uint8_t invertMask = 0;     // 0xFF если чернила - нулевой бит
+        bool bottomUp = false;      // BMP: строки снизу вверх
+        uint32_t rowPadding = 0;    // BMP: выравнивание строки до 4 байт
+    };
+
+    bool isSpace(int c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    bool isDigit(int c) {
+        return c >= '0' && c <= '9';
+    }
+
+    bool isIdentChar(int c) {
+        return isDigit(c) || c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    int hexValue(int c) {
+        if (isDigit(c)) return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    // === PBM ===
+
+    // Пробелы и комментарии '#' до конца строки
+    void skipPbmSpace(ByteStream& s) {
+        for (;;) {
+            const int c = s.peek();
+            if (c == '#') {
+                while (s.peek() >= 0 && s.get() != '\n') {}
+            } else if (isSpace(c)) {
+                s.get();
+            } else {
+                return;
+            }
+        }
+    }
+
+    bool readDecimal(ByteStream& s, uint32_t& value) {
+        if (!isDigit(s.peek())) {
+            return false;
+        }
+        value = 0;
+        while (isDigit(s.peek())) {
+            value = value * 10 + static_cast<uint32_t>(s.get() - '0');
+            if (value > kMaxDimension) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    OledResult parsePbm(ByteStream& s, ImageHeader& h) {
+        s.get();    // 'P'
+        const int kind = s.get();
+        if (kind == '1') {
+            h.encoding = Encoding::PbmAscii;
+        } else if (kind == '4') {
+            h.encoding = Encoding::Binary;
+        } else {
+            // P2/P3/P5/P6 - серые и цветные варианты Netpbm
+            return (kind >= '2' && kind <= '6') ? OledResult::Unsupported : OledResult::InvalidArg;
+        }
+
+        uint32_t width = 0;
+        uint32_t height = 0;
+        skipPbmSpace(s);
+        if (!readDecimal(s, width)) {
+            return OledResult::InvalidArg;
+        }
+        skipPbmSpace(s);
+        if (!readDecimal(s, height)) {
+            return OledResult::InvalidArg;
+        }
+        // P4: ровно один пробельный символ перед двоичными данными
+        if (h.encoding == Encoding::Binary && !isSpace(s.get())) {
+            return OledResult::InvalidArg;
+        }
+
+        h.info.format = ImageFormat::Pbm;
+        h.info.width = static_cast<uint16_t>(width);
+        h.info.height = static_cast<uint16_t>(height);
+        h.order = BitOrder::MsbFirst;
+        return OledResult::Ok;
+    }
+
+    // === XBM ===
+
+    // Пробелы, запятые и комментарии C
+    void skipXbmSpace(ByteStream& s) {
+        for (;;) {
+            const int c = s.peek();
+            if (isSpace(c) || c == ',') {
+                s.get();
+            } else if (c == '/') {
+                s.get();
+                if (s.peek() != '*') {
+                    return;
+                }
+                s.get();
+                int prev = 0;
+                for (int cur = s.get(); cur >= 0 && !(prev == '*' && cur == '/'); cur = s.get()) {
+                    prev = cur;
+                }
+            } else {
+                return;
+            }
+        }
+    }
+
+    // Идентификатор целиком не нужен - хранятся последние символы для суффикса
+    struct IdentTail {
+        static constexpr size_t kLength = 8;
+        char chars[kLength] = {};
+        size_t count = 0;
+
+        bool endsWith(const char* suffix) const {
+            const size_t n = std::strlen(suffix);
+            if (n > count || n > kLength) {
+                return false;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                if (chars[(count - n + i) % kLength] != suffix[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    IdentTail readIdent(ByteStream& s) {
+        IdentTail tail;
+        while (isIdentChar(s.peek())) {
+            tail.chars[tail.count % IdentTail::kLength] = static_cast<char>(s.get());
+            ++tail.count;
+        }
+        return tail;
+    }
+
+    bool readXbmNumber(ByteStream& s, uint32_t& value) {
+        skipXbmSpace(s);
+        if (!isDigit(s.peek())) {
+            return false;
+        }
+        const int first = s.get();
+        value = 0;
+        if (first == '0' && (s.peek() == 'x' || s.peek() == 'X')) {
+            s.get();
+            if (hexValue(s.peek()) < 0) {
+                return false;
+            }
+            while (hexValue(s.peek()) >= 0) {
+                value = value * 16 + static_cast<uint32_t>(hexValue(s.get()));
+                if (value > kMaxDimension) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        value = static_cast<uint32_t>(first - '0');
+        while (isDigit(s.peek())) {
+            value = value * 10 + static_cast<uint32_t>(s.get() - '0');
+            if (value > kMaxDimension) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    OledResult parseXbm(ByteStream& s, ImageHeader& h) {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        for (;;) {
+            skipXbmSpace(s);
+            const int c = s.peek();
+            if (c < 0) {
+                return OledResult::InvalidArg;
+            }
+            if (c == '{') {
+                s.get();
+                break;
+            }
+            if (c != '#') {
+                // static unsigned char name_bits[] = - без значения для разбора
+                if (isIdentChar(c)) {
+                    readIdent(s);
+                } else {
+                    s.get();
+                }
+                continue;
+            }
+
+            s.get();
+            if (!readIdent(s).endsWith("define")) {
+                while (s.peek() >= 0 && s.get() != '\n') {}
+                continue;
+            }
+            skipXbmSpace(s);
+            const IdentTail name = readIdent(s);
+            uint32_t value = 0;
+            if (!readXbmNumber(s, value)) {
+                return OledResult::InvalidArg;
+            }
+            if (name.endsWith("_width")) {
+                width = value;
+            } else if (name.endsWith("_height")) {
+                height = value;
+            }
+        }
+
+        h.info.format = ImageFormat::Xbm;
+        h.info.width = static_cast<uint16_t>(width);
+        h.info.height = static_cast<uint16_t>(height);
+        h.encoding = Encoding::XbmHex;
+        h.order = BitOrder::LsbFirst;
+        return OledResult::Ok;
+    }
+
+    // === BMP ===
+
+    bool readLe(ByteStream& s, int bytes, uint32_t& value) {
+        value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            const int c = s.get();
+            if (c < 0) {
+                return false;
+            }
+            value |= static_cast<uint32_t>(c) << (8 * i);
+        }
+        return true;
+    }
+
+    OledResult parseBmp(ByteStream& s, ImageHeader& h) {
+        uint32_t magic = 0;
+        uint32_t unused = 0;
+        uint32_t dataOffset = 0;
+        uint32_t headerSize = 0;
+        if (!readLe(s, 2, magic) || magic != kBmpMagic ||
+            !readLe(s, 4, unused) || !readLe(s, 4, unused) ||
+            !readLe(s, 4, dataOffset) || !readLe(s, 4, headerSize)) {
+            return OledResult::InvalidArg;
+        }
+
+        int32_t width = 0;
+        int32_t height = 0;
+        uint32_t bitCount = 0;
+        uint32_t compression = 0;
+        uint32_t paletteEntrySize = 0;
+        uint32_t field = 0;
+        if (headerSize == kBmpCoreHeaderSize) {
+            if (!readLe(s, 2, field)) return OledResult::InvalidArg;
+            width = static_cast<int32_t>(field);
+            if (!readLe(s, 2, field)) return OledResult::InvalidArg;
+            height = static_cast<int32_t>(field);
+            if (!readLe(s, 2, unused) || !readLe(s, 2, bitCount)) {
+                return OledResult::InvalidArg;
+            }
+            paletteEntrySize = 3;
+        } else if (headerSize >= kBmpInfoHeaderSize) {
+            if (!readLe(s, 4, field)) return OledResult::InvalidArg;
+            width = static_cast<int32_t>(field);
+            if (!readLe(s, 4, field)) return OledResult::InvalidArg;
+            height = static_cast<int32_t>(field);
+            if (!readLe(s, 2, unused) || !readLe(s, 2, bitCount) ||
+                !readLe(s, 4, compression) || !s.skip(headerSize - kBmpInfoFieldsRead)) {
+                return OledResult::InvalidArg;
+            }
+            paletteEntrySize = 4;
+        } else {
+            return OledResult::InvalidArg;
+        }
+
+        if (bitCount != 1 || compression != 0) {
+            return OledResult::Unsupported;
+        }
+        // Отрицательная высота - строки сверху вниз
+        h.bottomUp = height > 0;
+        const uint32_t absHeight = height > 0 ? static_cast<uint32_t>(height)
+                                              : 0u - static_cast<uint32_t>(height);
+        if (width <= 0 || static_cast<uint32_t>(width) > kMaxDimension || absHeight > kMaxDimension) {
+            return OledResult::InvalidArg;
+        }
+
+        // Палитра из двух цветов: чернила - более тёмный
+        if (s.consumed() + 2 * paletteEntrySize <= dataOffset) {
+            uint32_t luma[2] = {0, 0};
+            for (int i = 0; i < 2; ++i) {
+                uint32_t color = 0;
+                if (!readLe(s, static_cast<int>(paletteEntrySize), color)) {
+                    return OledResult::InvalidArg;
+                }
+                // BGR: 0.11 B + 0.59 G + 0.30 R в целых
+                luma[i] = (color & 0xFF) * 11 + ((color >> 8) & 0xFF) * 59 + ((color >> 16) & 0xFF) * 30;
+            }
+            h.invertMask = (luma[0] < luma[1]) ? 0xFF : 0x00;
+        }
+        if (s.consumed() > dataOffset || !s.skip(dataOffset - s.consumed())) {
+            return OledResult::InvalidArg;
+        }
+
+        const uint32_t dataBytes = (static_cast<uint32_t>(width) + 7) / 8;
+        h.info.format = ImageFormat::Bmp;
+        h.info.width = static_cast<uint16_t>(width);
+        h.info.height = static_cast<uint16_t>(absHeight);
+        h.encoding = Encoding::Binary;
+        h.order = BitOrder::MsbFirst;
+        h.rowPadding = ((dataBytes + 3) & ~3u) - dataBytes;
+        return OledResult::Ok;
+    }
+
+    OledResult parseHeader(ByteStream& s, ImageHeader& h) {
+        OledResult res;
+        const int c = s.peek();
+        if (c == 'P') {
+            res = parsePbm(s, h);
+        } else if (c == 'B') {
+            res = parseBmp(s, h);
+        } else if (c == '#' || c == '/' || isSpace(c)) {
+            res = parseXbm(s, h);
+        } else {
+            return OledResult::InvalidArg;
+        }
+        if (res == OledResult::Ok && (h.info.width == 0 || h.info.height == 0)) {
+            return OledResult::InvalidArg;
+        }
+        return res;
+    }
+
+    // Следующие 8 пикселей строки, MSB/LSB как в файле; -1 при ошибке
+    int readRowByte(ByteStream& s, const ImageHeader& h, uint16_t pixels) {
+        switch (h.encoding) {
+            case Encoding::Binary:
+                return s.get();
+
+            case Encoding::PbmAscii: {
+                int value = 0;
+                for (uint16_t i = 0; i < 8; ++i) {
+                    if (i < pixels) {
+                        skipPbmSpace(s);
+                        const int c = s.get();
+                        if (c != '0' && c != '1') {
+                            return -1;
+                        }
+                        value |= (c - '0') << (7 - i);
+                    }
+                }
+                return value;
+            }
+
+            case Encoding::XbmHex: {
+                uint32_t value = 0;
+                if (!readXbmNumber(s, value) || value > 0xFF) {
+                    return -1;
+                }
+                return static_cast<int>(value);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Сборка полосы из 8 строк и вывод блоками 8x8
+     *
+     * Хранятся только байты строки, попадающие в видимые колонки.
+     */
+    class StripWriter {
+    public:
+        StripWriter(Gfx& gfx, int x, int y, const ImageHeader& h, RasterOp op)
+            : gfx_(gfx), x_(x), y_(y), width_(h.info.width), height_(h.info.height),
+              order_(h.order), op_(op) {
+            const int colStart = x < 0 ? -x : 0;
+            int colEnd = gfx.width() - x;
+            if (colEnd > width_) colEnd = width_;
+            if (colEnd > colStart) {
+                byte0_ = static_cast<size_t>(colStart / 8);
+                bytes_ = static_cast<size_t>((colEnd + 7) / 8) - byte0_;
+                if (bytes_ > kStripBytes) bytes_ = kStripBytes;
+            }
+        }
+
+        size_t firstByte() const { return byte0_; }
+        size_t byteCount() const { return bytes_; }
+
+        // Куда сохранить видимые байты строки; nullptr если строка не видна
+        uint8_t* row(int index) {
+            const int block = index / 8;
+            if (block != block_) {
+                flush();
+                block_ = block;
+                visible_ = false;
+            }
+            const int screenY = y_ + index;
+            if (bytes_ == 0 || screenY < 0 || screenY >= gfx_.height()) {
+                return nullptr;
+            }
+            visible_ = true;
+            return rows_[index & 7];
+        }
+
+        void flush() {
+            if (!visible_) {
+                return;
+            }
+            visible_ = false;
+
+            const int top = block_ * 8;
+            const int h = (height_ - top < 8) ? height_ - top : 8;
+            for (size_t g = 0; g < bytes_; ++g) {
+                uint8_t block[8];
+                for (int j = 0; j < 8; ++j) {
+                    block[j] = rows_[j][g];
+                }
+                // out[i] - колонка i (LsbFirst) или 7 - i (MsbFirst), бит j = строка j
+                uint8_t columns[8];
+                FrameRotate::transpose8x8(block, columns);
+                if (order_ == BitOrder::MsbFirst) {
+                    for (int i = 0; i < 4; ++i) {
+                        const uint8_t t = columns[i];
+                        columns[i] = columns[7 - i];
+                        columns[7 - i] = t;
+                    }
+                }
+                const int col = static_cast<int>(8 * (byte0_ + g));
+                const int w = (width_ - col < 8) ? width_ - col : 8;
+                gfx_.blit(x_ + col, y_ + top, w, h, columns, op_);
+            }
+        }
+
+    private:
+        Gfx& gfx_;
+        int x_;
+        int y_;
+        int width_;
+        int height_;
+        BitOrder order_;
+        RasterOp op_;
+        size_t byte0_ = 0;
+        size_t bytes_ = 0;
+        int block_ = -1;
+        bool visible_ = false;
+        uint8_t rows_[8][kStripBytes] = {};
+    };
+
+    OledResult readBody(ByteStream& s, const ImageHeader& h, StripWriter& strip) {
+        const uint16_t rowBytes = static_cast<uint16_t>((h.info.width + 7) / 8);
+        const size_t byte0 = strip.firstByte();
+        const size_t byte1 = byte0 + strip.byteCount();
+
+        for (uint16_t i = 0; i < h.info.height; ++i) {
+            const int index = h.bottomUp ? h.info.height - 1 - i : i;
+            uint8_t* dst = strip.row(index);
+            for (uint16_t b = 0; b < rowBytes; ++b) {
+                const uint16_t pixels = static_cast<uint16_t>(h.info.width - 8 * b);
+                const int value = readRowByte(s, h, pixels);
+                if (value < 0) {
+                    strip.flush();
+                    return OledResult::InvalidArg;
+                }
+                if (dst && b >= byte0 && b < byte1) {
+                    dst[b - byte0] = static_cast<uint8_t>(value ^ h.invertMask);
+                }
+            }
+            // Выравнивание последней строки файла может отсутствовать
+            s.skip(h.rowPadding);
+        }
+        strip.flush();
+        return OledResult::Ok;
+    }
+}
+
+OledResult ImageImport::readInfo(IByteReader& reader, ImageInfo& info) {
+    ByteStream s(reader);
+    ImageHeader h;
+    const OledResult res = parseHeader(s, h);
+    info = h.info;
+    return res;
+}
+
+OledResult ImageImport::draw(IByteReader& reader, Gfx& gfx, int x, int y,
+                             RasterOp op, ImageInfo* info) {
+    if (!gfx.isInitialized()) {
+        return OledResult::NotInitialized;
+    }
+    ByteStream s(reader);
+    ImageHeader h;
+    const OledResult res = parseHeader(s, h);
+    if (info) {
+        *info = h.info;
+    }
+    if (res != OledResult::Ok) {
+        return res;
+    }
+    StripWriter strip(gfx, x, y, h, op);
+    return readBody(s, h, strip);
+}
+
+OledResult ImageImport::toBitmap(IByteReader& reader, uint8_t* dst, size_t capacity, ImageInfo& info) {
+    ByteStream s(reader);
+    ImageHeader h;
+    const OledResult res = parseHeader(s, h);
+    info = h.info;
+    if (res != OledResult::Ok) {
+        return res;
+    }
+
+    const uint32_t pages = (static_cast<uint32_t>(h.info.height) + 7) / 8;
+    if (!dst || h.info.width > MAX_STRIP_WIDTH || pages * 8 > kMaxDimension ||
+        capacity < static_cast<size_t>(h.info.width) * pages) {
+        return OledResult::InvalidArg;
+    }
+
+    // Битмап - тот же формат страниц: рисуем в него через временный Gfx
+    Gfx canvas;
+    canvas.init(dst, h.info.width, static_cast<uint16_t>(pages * 8));
+    canvas.clear();
+    StripWriter strip(canvas, 0, 0, h, RasterOp::Copy);
+    return readBody(s, h, strip);
+}
+
+} // namespace oled
+
+#endif // OLED_ENABLED
@@ -7,6 +7,8 @@
 #define OLED_MOCK_I2C_HPP
 
 #include "../../include/oled/ports/II2c.hpp"
+#include <deque>
+#include <mutex>
 #include <vector>
 #include <cstring>
 
@@ -43,6 +45,26 @@ public:
         return true;
     }
 
+    bool writeAsync(uint8_t addr7, const uint8_t* data, size_t len,
+                    WriteCallback callback, void* context) override {
+        if (!deferred_) {
+            return II2c::writeAsync(addr7, data, len, callback, context);
+        }
+
+        Transaction tx;
+        tx.addr7 = addr7;
+        tx.data.assign(data, data + len);
+        transactions_.push_back(tx);
+
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pending_.push_back(Pending{callback, context});
+        return true;
+    }
+
+    bool busy() const override {
+        return pendingCount() > 0;
+    }
+
     bool probe(uint8_t addr7) override {
         if (shouldFail_) {
             return false;
@@ -124,10 +146,54 @@ public:
         return memcmp(last.data.data(), expected, len) == 0;
     }
 
+    /**
+     * @brief Отложенный режим: writeAsync() только запоминает передачу,
+     * завершает её completeNext() (как прерывание контроллера)
+     */
+    void setDeferred(bool deferred) {
+        deferred_ = deferred;
+    }
+
+    /**
+     * @brief Завершить самую старую отложенную передачу
+     * @return false если завершать нечего
+     */
+    bool completeNext(bool ok = true) {
+        Pending next;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            if (pending_.empty()) {
+                return false;
+            }
+            next = pending_.front();
+            pending_.pop_front();
+        }
+        if (next.callback) {
+            next.callback(next.context, ok);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Количество незавершённых отложенных передач
+     */
+    size_t pendingCount() const {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        return pending_.size();
+    }
+
 private:
+    struct Pending {
+        WriteCallback callback = nullptr;
+        void* context = nullptr;
+    };
+
     std::vector<Transaction> transactions_;
     std::vector<uint8_t> respondingAddresses_;
     bool shouldFail_ = false;
+    bool deferred_ = false;
+    std::deque<Pending> pending_;
+    mutable std::mutex pendingMutex_;
 };
 
 } // namespace test
@@ -0,0 +1,111 @@
+/**
+ * @file stm32_hal_legacy.h
+ * @brief Host-заглушка STM32 HAL для тестов DMA
+ *
+ * Подменяет HAL, который включает Stm32HalI2cAdapter.hpp без макроса
+ * семейства STM32 (GPIO и HAL_Delay - для фасада OledSsd1315 в test_facade).
+ * HAL_I2C_Master_Transmit_DMA только запоминает передачу.
+ * halShimComplete() имитирует прерывание окончания DMA: снимает байты,
+ * которые прочитал бы контроллер, и вызывает HAL_I2C_MasterTxCpltCallback
+ * (или HAL_I2C_ErrorCallback). Оба callback определяет тест.
+ */
+
+#ifndef OLED_TEST_STM32_HAL_SHIM_H
+#define OLED_TEST_STM32_HAL_SHIM_H
+
+#include <cstdint>
+#include <vector>
+
+typedef struct { int dummy; } I2C_HandleTypeDef;
+typedef struct { int dummy; } GPIO_TypeDef;
+typedef struct { uint32_t Pin, Mode, Pull, Speed; } GPIO_InitTypeDef;
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+#define GPIO_MODE_OUTPUT_OD 0x11u
+#define GPIO_PULLUP 0x1u
+#define GPIO_SPEED_FREQ_LOW 0x0u
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef* hi2c);
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* hi2c);
+
+/**
+ * @brief Состояние заглушки
+ */
+struct HalShim {
+    struct Transfer {
+        uint16_t addr8;
+        std::vector<uint8_t> data;  // Байты на момент окончания передачи
+        const uint8_t* source;      // Откуда читал DMA
+    };
+
+    I2C_HandleTypeDef* dmaHandle = nullptr;
+    uint8_t* dmaData = nullptr;
+    uint16_t dmaLen = 0;
+    uint16_t dmaAddr8 = 0;
+    bool failStart = false;
+    std::vector<Transfer> transfers;
+};
+
+inline HalShim& halShim() {
+    static HalShim shim;
+    return shim;
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef*, uint16_t addr8, uint8_t* data,
+                                                 uint16_t len, uint32_t) {
+    HalShim& shim = halShim();
+    if (shim.dmaData != nullptr) {
+        return HAL_BUSY;
+    }
+    shim.transfers.push_back(HalShim::Transfer{addr8, std::vector<uint8_t>(data, data + len), data});
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef* hi2c, uint16_t addr8,
+                                                     uint8_t* data, uint16_t len) {
+    HalShim& shim = halShim();
+    if (shim.failStart) {
+        return HAL_ERROR;
+    }
+    if (shim.dmaData != nullptr) {
+        return HAL_BUSY;
+    }
+    shim.dmaHandle = hi2c;
+    shim.dmaData = data;
+    shim.dmaLen = len;
+    shim.dmaAddr8 = addr8;
+    return HAL_OK;
+}
+
+inline HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef*, uint16_t, uint32_t, uint32_t) {
+    return HAL_OK;
+}
+
+inline void HAL_GPIO_Init(GPIO_TypeDef*, GPIO_InitTypeDef*) {}
+inline void HAL_GPIO_WritePin(GPIO_TypeDef*, uint16_t, GPIO_PinState) {}
+inline GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef*, uint16_t) { return GPIO_PIN_SET; }
+inline void HAL_Delay(uint32_t) {}
+
+/**
+ * @brief Завершить текущую DMA передачу, как прерывание контроллера
+ * @return false если DMA не запущен
+ */
+inline bool halShimComplete(bool ok = true) {
+    HalShim& shim = halShim();
+    if (shim.dmaData == nullptr) {
+        return false;
+    }
+    shim.transfers.push_back(HalShim::Transfer{
+        shim.dmaAddr8, std::vector<uint8_t>(shim.dmaData, shim.dmaData + shim.dmaLen), shim.dmaData});
+    I2C_HandleTypeDef* hi2c = shim.dmaHandle;
+    shim.dmaData = nullptr;
+    if (ok) {
+        HAL_I2C_MasterTxCpltCallback(hi2c);
+    } else {
+        HAL_I2C_ErrorCallback(hi2c);
+    }
+    return true;
+}
+
+#endif // OLED_TEST_STM32_HAL_SHIM_H
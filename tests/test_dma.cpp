@@ -0,0 +1,278 @@
+/**
+ * @file test_dma.cpp
+ * @brief Unit-тесты очереди DMA дескрипторов и STM32 адаптера на host-заглушке HAL
+ */
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../include/oled/domain/FrameDmaQueue.hpp"
+#include "../include/oled/adapters/Stm32HalI2cAdapter.hpp"
+#include "mocks/MockI2c.hpp"
+
+using namespace oled;
+using namespace oled::test;
+
+namespace {
+
+Stm32HalI2cAdapter* gAdapter = nullptr;
+
+} // anonymous namespace
+
+// Прерывания HAL: как в stm32xx_it.c через OledSsd1315::onDmaComplete()
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef*) {
+    gAdapter->onTxComplete(true);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef*) {
+    gAdapter->onTxComplete(false);
+}
+
+namespace {
+
+constexpr uint16_t kWidth = 128;
+constexpr uint8_t kPages = 8;
+
+// Кадр с зарезервированным байтом перед пикселями, как PrefixedFrame
+struct TestFrame {
+    uint8_t data[1 + kWidth * kPages];
+
+    TestFrame() {
+        data[0] = 0x40;
+        for (size_t i = 1; i < sizeof(data); ++i) {
+            data[i] = static_cast<uint8_t>(i * 13 + 5);
+        }
+    }
+
+    uint8_t* pixels() { return data + 1; }
+};
+
+std::vector<uint8_t> windowBytes(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    return {0x00, 0x21, x0, x1, 0x22, p0, p1};
+}
+
+std::vector<uint8_t> dataBytes(const uint8_t* pixels, uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1) {
+    std::vector<uint8_t> out{0x40};
+    if (x0 == 0 && x1 == kWidth - 1) {
+        out.insert(out.end(), pixels + p0 * kWidth, pixels + (p1 + 1) * kWidth);
+        return out;
+    }
+    for (uint8_t page = p0; page <= p1; ++page) {
+        out.insert(out.end(), pixels + page * kWidth + x0, pixels + page * kWidth + x1 + 1);
+    }
+    return out;
+}
+
+class DmaTest {
+public:
+    void testBuildDescriptors() {
+        TestFrame frame;
+        FrameDmaQueue queue;
+
+        // Страница 0 частично, 1 пропущена, 2-7 на всю ширину - одно окно
+        PageSpan spans[kPages];
+        spans[0] = {10, 20};
+        spans[1] = {0xFF, 0};
+        for (uint8_t page = 2; page < kPages; ++page) {
+            spans[page] = {0, kWidth - 1};
+        }
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages) == OledResult::Ok);
+        assert(queue.size() == 9);
+
+        // Окно в середине кадра - строки страниц через буфер очереди
+        assert(queue.descriptor(1).source == DmaSource::Staged);
+        assert(queue.descriptor(1).data == frame.pixels() + 10);
+        assert(queue.descriptor(1).len == 11 + 1);
+        assert(queue.descriptor(2).source == DmaSource::Command);
+        for (uint8_t i = 3; i < 9; ++i) {
+            assert(queue.descriptor(i).source == DmaSource::Staged);
+            assert(queue.descriptor(i).data == frame.pixels() + (i - 1) * kWidth);
+            assert(queue.descriptor(i).len == kWidth + 1);
+        }
+
+        // Весь кадр - одна передача с зарезервированного префикса
+        for (uint8_t page = 0; page < kPages; ++page) {
+            spans[page] = {0, kWidth - 1};
+        }
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages) == OledResult::Ok);
+        assert(queue.size() == 2);
+        assert(queue.descriptor(1).source == DmaSource::Frame);
+        assert(queue.descriptor(1).data == frame.data);
+        assert(queue.descriptor(1).len == sizeof(frame.data));
+
+        // Ничего не изменилось - пустая очередь, шина не нужна
+        for (uint8_t page = 0; page < kPages; ++page) {
+            spans[page] = {0xFF, 0};
+        }
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages) == OledResult::Ok);
+        assert(queue.size() == 0);
+
+        // Начальная строка - первым дескриптором, и без изменённых окон
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages, 0, 24) == OledResult::Ok);
+        assert(queue.size() == 1);
+        assert(queue.descriptor(0).source == DmaSource::Command);
+        assert(queue.descriptor(0).len == 2);
+        assert(queue.descriptor(0).data[0] == 0x00 && queue.descriptor(0).data[1] == (0x40 | 24));
+        spans[3] = {5, 6};
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages, 0, 8) == OledResult::Ok);
+        assert(queue.size() == 3);
+        assert(queue.descriptor(0).data[1] == (0x40 | 8));
+        assert(queue.descriptor(1).source == DmaSource::Command);
+        assert(queue.descriptor(2).source == DmaSource::Staged);
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages, 0, 64) == OledResult::InvalidArg);
+
+        // Неверные аргументы
+        spans[0] = {0, kWidth};
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages) == OledResult::InvalidArg);
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages + 1) == OledResult::InvalidArg);
+        assert(queue.build(nullptr, kWidth, spans, kPages) == OledResult::InvalidArg);
+
+        printf("[PASS] testBuildDescriptors\n");
+    }
+
+    void testChainFromInterrupts() {
+        TestFrame frame;
+        const TestFrame original;
+        I2C_HandleTypeDef hi2c{};
+        Stm32HalI2cAdapter adapter;
+        adapter.init(&hi2c);
+        gAdapter = &adapter;
+        halShim() = HalShim();
+
+        PageSpan spans[kPages];
+        for (uint8_t page = 0; page < kPages; ++page) {
+            spans[page] = {0xFF, 0};
+        }
+        spans[1] = {5, 9};
+        spans[3] = {0, kWidth - 1};
+        spans[4] = {0, kWidth - 1};
+        spans[6] = {100, 127};
+
+        FrameDmaQueue queue;
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages, 0) == OledResult::Ok);
+        assert(queue.start(adapter, 0x3C) == OledResult::Ok);
+        assert(queue.active() && adapter.busy());
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+
+        // Пока DMA не завершён, следующий дескриптор не начинается
+        assert(queue.build(frame.pixels(), kWidth, spans, kPages) == OledResult::Busy);
+        assert(queue.start(adapter, 0x3C) == OledResult::Busy);
+
+        // Каждое прерывание запускает следующий дескриптор
+        size_t interrupts = 0;
+        while (halShimComplete()) {
+            ++interrupts;
+        }
+        assert(interrupts == 7);
+        assert(!queue.active() && !adapter.busy());
+        assert(queue.result() == OledResult::Ok);
+
+        // Страницы 3-4 - одно окно, данные строка за строкой
+        const std::vector<std::vector<uint8_t>> expected = {
+            windowBytes(5, 9, 1, 1),
+            dataBytes(original.data + 1, 5, 9, 1, 1),
+            windowBytes(0, 127, 3, 4),
+            dataBytes(original.data + 1, 0, 127, 3, 3),
+            dataBytes(original.data + 1, 0, 127, 4, 4),
+            windowBytes(100, 127, 6, 6),
+            dataBytes(original.data + 1, 100, 127, 6, 6),
+        };
+        const std::vector<HalShim::Transfer>& transfers = halShim().transfers;
+        assert(transfers.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(transfers[i].addr8 == (0x3C << 1));
+            assert(transfers[i].data == expected[i]);
+        }
+
+        // Пиксели кадра не тронуты: control byte стоит в буфере очереди
+        assert(transfers[1].source < frame.data || transfers[1].source >= frame.data + sizeof(frame.data));
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+
+        printf("[PASS] testChainFromInterrupts\n");
+    }
+
+    void testErrors() {
+        TestFrame frame;
+        const TestFrame original;
+        I2C_HandleTypeDef hi2c{};
+        Stm32HalI2cAdapter adapter;
+        adapter.init(&hi2c);
+        gAdapter = &adapter;
+        halShim() = HalShim();
+
+        PageSpan spans[2] = {{3, 7}, {40, 50}};
+        FrameDmaQueue queue;
+
+        // Ошибка шины на данных: очередь останавливается, кадр не тронут
+        assert(queue.build(frame.pixels(), kWidth, spans, 2) == OledResult::Ok);
+        assert(queue.start(adapter, 0x3C) == OledResult::Ok);
+        assert(halShimComplete(true));
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+        assert(halShimComplete(false));
+        assert(!queue.active() && queue.result() == OledResult::I2cError);
+        assert(!halShimComplete());
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+
+        // HAL не принял передачу
+        halShim().failStart = true;
+        assert(queue.build(frame.pixels(), kWidth, spans, 2) == OledResult::Ok);
+        assert(queue.start(adapter, 0x3C) == OledResult::I2cError);
+        assert(!queue.active() && !adapter.busy());
+        halShim().failStart = false;
+
+        // Блокирующая запись во время DMA - шина занята
+        assert(queue.start(adapter, 0x3C) == OledResult::Ok);
+        const uint8_t cmdByte[] = {0x00, 0xAF};
+        assert(!adapter.write(0x3C, cmdByte, sizeof(cmdByte)));
+        while (halShimComplete()) {
+        }
+        assert(adapter.write(0x3C, cmdByte, sizeof(cmdByte)));
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+
+        printf("[PASS] testErrors\n");
+    }
+
+    void testSynchronousAdapter() {
+        // writeAsync() по умолчанию: вся очередь проходит внутри start()
+        TestFrame frame;
+        const TestFrame original;
+        MockI2c mockI2c;
+        PageSpan spans[2] = {{0, kWidth - 1}, {60, 61}};
+
+        FrameDmaQueue queue;
+        assert(queue.build(frame.pixels(), kWidth, spans, 2, 4) == OledResult::Ok);
+        assert(queue.start(mockI2c, 0x3C) == OledResult::Ok);
+        assert(!queue.active() && queue.result() == OledResult::Ok);
+        assert(mockI2c.transactionCount() == 4);
+        assert(mockI2c.transactions()[0].data == windowBytes(0, 127, 4, 4));
+        assert(mockI2c.transactions()[1].data == dataBytes(original.data + 1, 0, 127, 0, 0));
+        assert(mockI2c.transactions()[2].data == windowBytes(60, 61, 5, 5));
+        assert(mockI2c.transactions()[3].data == dataBytes(original.data + 1, 60, 61, 1, 1));
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+
+        mockI2c.setFail(true);
+        assert(queue.start(mockI2c, 0x3C) == OledResult::I2cError);
+        assert(memcmp(frame.data, original.data, sizeof(frame.data)) == 0);
+
+        printf("[PASS] testSynchronousAdapter\n");
+    }
+
+    void runAll() {
+        printf("=== FrameDmaQueue Unit Tests ===\n");
+        testBuildDescriptors();
+        testChainFromInterrupts();
+        testErrors();
+        testSynchronousAdapter();
+        printf("=== All tests passed ===\n");
+    }
+};
+
+} // anonymous namespace
+
+int main() {
+    DmaTest test;
+    test.runAll();
+    return 0;
+}
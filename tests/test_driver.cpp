@@ -5,6 +5,9 @@
 
 #include <cassert>
 #include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 #define OLED_SSD1315_ENABLE 1
 #define OLED_USE_ARDUINO 0
@@ -12,6 +15,7 @@
 #define OLED_ENABLED 1
 
 #include "../include/oled/domain/Ssd1315Driver.hpp"
+#include "../include/oled/domain/FrameDiff.hpp"
 #include "../include/oled/OledTypes.hpp"
 #include "mocks/MockI2c.hpp"
 
@@ -141,6 +145,417 @@ public:
         printf("[PASS] testWriteBufferNullptr\n");
     }
 
+    void testWriteRegion() {
+        MockI2c mockI2c;
+
+        Ssd1315Driver driver;
+        OledConfig cfg;
+        cfg.i2cAddr7 = 0x3C;
+        cfg.width = 128;
+        cfg.height = 64;
+
+        driver.init(mockI2c, cfg);
+        mockI2c.clearTransactions();
+
+        uint8_t buffer[1024];
+        for (size_t i = 0; i < sizeof(buffer); ++i) {
+            buffer[i] = static_cast<uint8_t>(i);
+        }
+
+        OledResult result = driver.writeRegion(buffer, 10, 13, 2, 3);
+        assert(result == OledResult::Ok);
+
+        // Окно: control byte + SET_COLUMN_ADDR + SET_PAGE_ADDR одним пакетом
+        const auto& txs = mockI2c.transactions();
+        assert(txs.size() == 3);
+        const uint8_t expectedWindow[] = {0x00, 0x21, 10, 13, 0x22, 2, 3};
+        assert(txs[0].data.size() == sizeof(expectedWindow));
+        assert(memcmp(txs[0].data.data(), expectedWindow, sizeof(expectedWindow)) == 0);
+
+        // Данные: только колонки окна каждой страницы
+        for (size_t p = 0; p < 2; ++p) {
+            const auto& data = txs[1 + p].data;
+            assert(data.size() == 5);
+            assert(data[0] == 0x40);
+            assert(memcmp(&data[1], &buffer[(2 + p) * 128 + 10], 4) == 0);
+        }
+
+        // Неверное окно
+        assert(driver.writeRegion(buffer, 13, 10, 0, 0) == OledResult::InvalidArg);
+        assert(driver.writeRegion(buffer, 0, 128, 0, 0) == OledResult::InvalidArg);
+        assert(driver.writeRegion(buffer, 0, 127, 0, 8) == OledResult::InvalidArg);
+
+        printf("[PASS] testWriteRegion\n");
+    }
+
+    void testRotation180() {
+        // Rotation::R180 - аппаратный remap; вместе с flip180 взаимно гасятся
+        const struct { bool flip; Rotation rotation; uint8_t remap; uint8_t scan; } cases[] = {
+            {false, Rotation::R0,   0xA1, 0xC8},
+            {true,  Rotation::R0,   0xA0, 0xC0},
+            {false, Rotation::R180, 0xA0, 0xC0},
+            {true,  Rotation::R180, 0xA1, 0xC8},
+            {false, Rotation::R90,  0xA1, 0xC8},   // 90/270 - программно
+        };
+        for (const auto& c : cases) {
+            MockI2c mockI2c;
+            Ssd1315Driver driver;
+            OledConfig cfg;
+            cfg.flip180 = c.flip;
+            cfg.rotation = c.rotation;
+            assert(driver.init(mockI2c, cfg) == OledResult::Ok);
+
+            bool remapSent = false;
+            bool scanSent = false;
+            for (const auto& tx : mockI2c.transactions()) {
+                if (tx.data.size() == 2 && tx.data[0] == 0x00) {
+                    remapSent |= (tx.data[1] == c.remap);
+                    scanSent |= (tx.data[1] == c.scan);
+                }
+            }
+            assert(remapSent && scanSent);
+        }
+
+        printf("[PASS] testRotation180\n");
+    }
+
+    void testStartLine() {
+        MockI2c mockI2c;
+        Ssd1315Driver driver;
+        OledConfig cfg;
+        assert(driver.setStartLine(8) == OledResult::NotInitialized);
+        assert(driver.setDisplayOffset(8) == OledResult::NotInitialized);
+
+        driver.init(mockI2c, cfg);
+        mockI2c.clearTransactions();
+
+        // Одна команда на шаг прокрутки
+        assert(driver.setStartLine(40) == OledResult::Ok);
+        const uint8_t expectedLine[] = {0x00, 0x40 | 40};
+        assert(mockI2c.transactionCount() == 1);
+        assert(mockI2c.lastTransactionContains(expectedLine, sizeof(expectedLine)));
+        assert(driver.startLine() == 40);
+
+        assert(driver.setDisplayOffset(16) == OledResult::Ok);
+        const uint8_t expectedOffset[] = {0x00, 0xD3, 16};
+        assert(mockI2c.lastTransactionContains(expectedOffset, sizeof(expectedOffset)));
+        assert(driver.displayOffset() == 16);
+
+        // Вне 0-63 - без передачи
+        mockI2c.clearTransactions();
+        assert(driver.setStartLine(64) == OledResult::InvalidArg);
+        assert(driver.setDisplayOffset(64) == OledResult::InvalidArg);
+        assert(mockI2c.transactionCount() == 0);
+        assert(driver.startLine() == 40 && driver.displayOffset() == 16);
+
+        // Ошибка шины не меняет состояние
+        mockI2c.setFail(true);
+        assert(driver.setStartLine(8) == OledResult::I2cError);
+        assert(driver.startLine() == 40);
+        mockI2c.setFail(false);
+
+        // init() выставляет 0 в контроллере и в драйвере
+        driver.init(mockI2c, cfg);
+        assert(driver.startLine() == 0 && driver.displayOffset() == 0);
+
+        printf("[PASS] testStartLine\n");
+    }
+
+    void testScroll() {
+        MockI2c mockI2c;
+        Ssd1315Driver driver;
+        OledConfig cfg;
+        assert(driver.stopScroll() == OledResult::NotInitialized);
+
+        driver.init(mockI2c, cfg);
+        assert(!driver.isScrolling());
+        mockI2c.clearTransactions();
+
+        // Остановка, настройка страниц 2-5 на всю ширину, запуск
+        assert(driver.scrollHorizontal(ScrollDirection::Left, 2, 5, ScrollInterval::Frames2) == OledResult::Ok);
+        assert(mockI2c.transactionCount() == 3);
+        const uint8_t expectedStop[] = {0x00, 0x2E};
+        const uint8_t expectedLeft[] = {0x00, 0x27, 0x00, 2, 0x07, 5, 0, 127};
+        const uint8_t expectedStart[] = {0x00, 0x2F};
+        assert(mockI2c.transactions()[0].data == std::vector<uint8_t>(expectedStop, expectedStop + 2));
+        assert(mockI2c.transactions()[1].data == std::vector<uint8_t>(expectedLeft, expectedLeft + 8));
+        assert(mockI2c.lastTransactionContains(expectedStart, sizeof(expectedStart)));
+        assert(driver.isScrolling());
+
+        // Запись в GDDRAM запрещена до остановки
+        uint8_t buffer[128 * 64 / 8] = {0};
+        mockI2c.clearTransactions();
+        assert(driver.writeRegion(buffer, 0, 7, 0, 0) == OledResult::Busy);
+        assert(driver.scrollContent(ScrollDirection::Left, 0, 0, 0, 127) == OledResult::Busy);
+        assert(mockI2c.transactionCount() == 0);
+
+        assert(driver.stopScroll() == OledResult::Ok);
+        assert(!driver.isScrolling());
+        assert(driver.writeRegion(buffer, 0, 7, 0, 0) == OledResult::Ok);
+
+        // Диагональная: 9 байт в одном пакете
+        assert(driver.setVerticalScrollArea(16, 48) == OledResult::Ok);
+        const uint8_t expectedArea[] = {0x00, 0xA3, 16, 48};
+        assert(mockI2c.lastTransactionContains(expectedArea, sizeof(expectedArea)));
+        mockI2c.clearTransactions();
+        assert(driver.scrollDiagonal(ScrollDirection::Right, 0, 7, ScrollInterval::Frames6, 1) == OledResult::Ok);
+        const uint8_t expectedDiag[] = {0x00, 0x29, 0x00, 0, 0x00, 7, 1, 0, 127};
+        assert(mockI2c.transactions()[1].data == std::vector<uint8_t>(expectedDiag, expectedDiag + 9));
+        driver.stopScroll();
+
+        // Сдвиг окна на колонку - одна команда без запуска прокрутки
+        mockI2c.clearTransactions();
+        assert(driver.scrollContent(ScrollDirection::Right, 6, 7, 8, 119) == OledResult::Ok);
+        const uint8_t expectedContent[] = {0x00, 0x2C, 0x00, 6, 0x01, 7, 8, 119};
+        assert(mockI2c.transactionCount() == 1);
+        assert(mockI2c.lastTransactionContains(expectedContent, sizeof(expectedContent)));
+        assert(!driver.isScrolling());
+
+        // Неверные окна - без передачи
+        mockI2c.clearTransactions();
+        assert(driver.scrollHorizontal(ScrollDirection::Right, 5, 2, ScrollInterval::Frames5) == OledResult::InvalidArg);
+        assert(driver.scrollHorizontal(ScrollDirection::Right, 0, 8, ScrollInterval::Frames5) == OledResult::InvalidArg);
+        assert(driver.scrollDiagonal(ScrollDirection::Left, 0, 7, ScrollInterval::Frames5, 64) == OledResult::InvalidArg);
+        assert(driver.setVerticalScrollArea(32, 33) == OledResult::InvalidArg);
+        assert(driver.scrollContent(ScrollDirection::Left, 0, 7, 10, 9) == OledResult::InvalidArg);
+        assert(driver.scrollContent(ScrollDirection::Left, 0, 7, 0, 128) == OledResult::InvalidArg);
+        assert(mockI2c.transactionCount() == 0);
+
+        // Ошибка шины при запуске - прокрутка не считается активной
+        mockI2c.setFail(true);
+        assert(driver.scrollHorizontal(ScrollDirection::Right, 0, 7, ScrollInterval::Frames5) == OledResult::I2cError);
+        assert(!driver.isScrolling());
+        mockI2c.setFail(false);
+
+        // init() останавливает прокрутку
+        driver.scrollHorizontal(ScrollDirection::Right, 0, 7, ScrollInterval::Frames5);
+        driver.init(mockI2c, cfg);
+        assert(!driver.isScrolling());
+
+        printf("[PASS] testScroll\n");
+    }
+
+    void testPageFlip() {
+        MockI2c mockI2c;
+        Ssd1315Driver driver;
+        OledConfig cfg;
+
+        // 64 строки - скрытой половины нет
+        driver.init(mockI2c, cfg);
+        assert(driver.setPageFlip(true) == OledResult::Unsupported);
+        assert(!driver.pageFlip() && driver.backPage() == 0);
+
+        cfg.height = 32;
+        driver.init(mockI2c, cfg);
+        assert(driver.setPageFlip(true) == OledResult::Ok);
+        assert(driver.pageFlip() && driver.backPage() == 4);
+
+        // Запись уходит в страницы 4-7, показ - одна команда
+        uint8_t buffer[128 * 32 / 8] = {0};
+        mockI2c.clearTransactions();
+        assert(driver.writeRegion(buffer, 10, 20, 1, 2) == OledResult::Ok);
+        const uint8_t expectedBack[] = {0x00, 0x21, 10, 20, 0x22, 5, 6};
+        assert(mockI2c.transactions()[0].data == std::vector<uint8_t>(expectedBack, expectedBack + 7));
+
+        mockI2c.clearTransactions();
+        assert(driver.flip() == OledResult::Ok);
+        const uint8_t expectedFlip[] = {0x00, 0x40 | 32};
+        assert(mockI2c.transactionCount() == 1);
+        assert(mockI2c.lastTransactionContains(expectedFlip, sizeof(expectedFlip)));
+        assert(driver.backPage() == 0 && driver.startLine() == 32);
+
+        // Теперь скрыты страницы 0-3
+        mockI2c.clearTransactions();
+        assert(driver.writeBuffer(buffer, sizeof(buffer)) == OledResult::Ok);
+        const uint8_t expectedFront[] = {0x00, 0x21, 0, 127, 0x22, 0, 3};
+        assert(mockI2c.transactions()[0].data == std::vector<uint8_t>(expectedFront, expectedFront + 7));
+
+        // Ошибка шины - половины не меняются
+        mockI2c.setFail(true);
+        assert(driver.flip() == OledResult::I2cError);
+        assert(driver.backPage() == 0 && driver.startLine() == 32);
+        mockI2c.setFail(false);
+        assert(driver.flip() == OledResult::Ok);
+        assert(driver.backPage() == 4 && driver.startLine() == 0);
+
+        // Выключение возвращает показ страниц 0-3 и запись в них
+        driver.flip();
+        assert(driver.setPageFlip(false) == OledResult::Ok);
+        assert(!driver.pageFlip() && driver.backPage() == 0 && driver.startLine() == 0);
+        assert(driver.flip() == OledResult::Unsupported);
+
+        // init() выключает режим
+        driver.setPageFlip(true);
+        driver.init(mockI2c, cfg);
+        assert(!driver.pageFlip() && driver.backPage() == 0);
+
+        printf("[PASS] testPageFlip\n");
+    }
+
+    void testAsyncFlush() {
+        MockI2c mockI2c;
+        Ssd1315Driver driver;
+        OledConfig cfg;
+        driver.init(mockI2c, cfg);
+
+        uint8_t buffer[128 * 64 / 8];
+        for (size_t i = 0; i < sizeof(buffer); ++i) {
+            buffer[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+
+        // Страница 0 частично, 1 пропущена, 2-7 на всю ширину - одним окном
+        PageSpan spans[8];
+        spans[0] = {10, 20};
+        spans[1] = {0xFF, 0};
+        for (int page = 2; page < 8; ++page) {
+            spans[page] = {0, 127};
+        }
+
+        mockI2c.clearTransactions();
+        assert(driver.writeRegion(buffer, 10, 20, 0, 0) == OledResult::Ok);
+        assert(driver.writeRegion(buffer, 0, 127, 2, 7) == OledResult::Ok);
+        const std::vector<MockI2c::Transaction> expected = mockI2c.transactions();
+
+        auto sameAsBlocking = [&]() {
+            if (mockI2c.transactionCount() != expected.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < expected.size(); ++i) {
+                if (mockI2c.transactions()[i].data != expected[i].data) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // Синхронный адаптер (writeAsync по умолчанию) - всё до возврата
+        mockI2c.clearTransactions();
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Ok);
+        assert(!driver.asyncBusy());
+        assert(driver.poll() == OledResult::Ok);
+        assert(sameAsBlocking());
+
+        // Poll: одна передача на шине, следующую запускает poll()
+        mockI2c.setDeferred(true);
+        mockI2c.clearTransactions();
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Ok);
+        assert(driver.asyncBusy() && mockI2c.transactionCount() == 1);
+        assert(driver.poll() == OledResult::Busy);
+        assert(mockI2c.transactionCount() == 1);
+
+        // Окно и запись GDDRAM заняты
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Busy);
+        assert(driver.writeRegion(buffer, 0, 0, 0, 0) == OledResult::Busy);
+
+        while (driver.poll() == OledResult::Busy) {
+            mockI2c.completeNext();
+        }
+        assert(driver.poll() == OledResult::Ok);
+        assert(mockI2c.pendingCount() == 0);
+        assert(sameAsBlocking());
+
+        // Callback: цепочка идёт из завершений без poll()
+        driver.setAsyncDrive(AsyncDrive::Callback);
+        mockI2c.clearTransactions();
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Ok);
+        while (mockI2c.completeNext()) {
+        }
+        assert(!driver.asyncBusy());
+        assert(driver.poll() == OledResult::Ok);
+        assert(sameAsBlocking());
+
+        // Ошибка шины останавливает передачу
+        mockI2c.clearTransactions();
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Ok);
+        mockI2c.completeNext(true);
+        mockI2c.completeNext(false);
+        assert(!driver.asyncBusy() && mockI2c.pendingCount() == 0);
+        assert(mockI2c.transactionCount() == 2);
+        assert(driver.poll() == OledResult::I2cError);
+
+        // init() во время передачи не трогает шину и конфигурацию
+        mockI2c.clearTransactions();
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Ok);
+        MockI2c otherI2c;
+        OledConfig otherCfg;
+        otherCfg.width = 64;
+        assert(driver.init(otherI2c, otherCfg) == OledResult::Busy);
+        assert(driver.isReady() && driver.config().width == 128);
+        while (mockI2c.completeNext()) {
+        }
+        assert(driver.poll() == OledResult::Ok);
+        assert(otherI2c.transactionCount() == 0);
+        assert(sameAsBlocking());
+
+        // Неверные колонки
+        spans[0] = {10, 128};
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::InvalidArg);
+        spans[0] = {10, 20};
+        assert(driver.writeSpansAsync(buffer, spans, 9) == OledResult::InvalidArg);
+
+        // Завершения из другого потока, основной цикл опрашивает
+        driver.setAsyncDrive(AsyncDrive::Poll);
+        mockI2c.clearTransactions();
+        assert(driver.writeSpansAsync(buffer, spans, 8) == OledResult::Ok);
+        std::thread irq([&]() {
+            for (size_t done = 0; done < expected.size();) {
+                if (mockI2c.completeNext()) {
+                    ++done;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        OledResult res;
+        while ((res = driver.poll()) == OledResult::Busy) {
+            std::this_thread::yield();
+        }
+        irq.join();
+        assert(res == OledResult::Ok);
+        assert(sameAsBlocking());
+
+        printf("[PASS] testAsyncFlush\n");
+    }
+
+    void testFrameDiff() {
+        uint8_t frame[128] = {0};
+        uint8_t shadow[128] = {0};
+        DiffRun runs[4];
+
+        // Без изменений - ни одного run
+        assert(FrameDiff::diffRow(frame, shadow, 128, runs, 4) == 0);
+
+        // Два далёких изменения - два окна
+        frame[3] = 0xFF;
+        frame[100] = 0x01;
+        frame[101] = 0x02;
+        assert(FrameDiff::diffRow(frame, shadow, 128, runs, 4) == 2);
+        assert(runs[0].colStart == 3 && runs[0].colEnd == 3);
+        assert(runs[1].colStart == 100 && runs[1].colEnd == 101);
+
+        // Разрыв не длиннее RUN_OVERHEAD склеивается
+        frame[3 + FrameDiff::RUN_OVERHEAD + 1] = 0x10;
+        assert(FrameDiff::diffRow(frame, shadow, 128, runs, 4) == 2);
+        assert(runs[0].colStart == 3 && runs[0].colEnd == 3 + FrameDiff::RUN_OVERHEAD + 1);
+
+        // Разрыв длиннее - отдельное окно
+        frame[40] = 0x20;
+        assert(FrameDiff::diffRow(frame, shadow, 128, runs, 4) == 3);
+        assert(runs[1].colStart == 40 && runs[1].colEnd == 40);
+
+        // Переполнение: последний run поглощает остаток
+        assert(FrameDiff::diffRow(frame, shadow, 128, runs, 2) == 2);
+        assert(runs[1].colStart == 40 && runs[1].colEnd == 101);
+
+        // Изменение в последнем байте
+        memset(frame, 0, sizeof(frame));
+        frame[127] = 0x80;
+        assert(FrameDiff::diffRow(frame, shadow, 128, runs, 4) == 1);
+        assert(runs[0].colStart == 127 && runs[0].colEnd == 127);
+
+        printf("[PASS] testFrameDiff\n");
+    }
+
     void runAll() {
         printf("=== Ssd1315Driver Unit Tests ===\n");
         testInitSuccess();
@@ -151,6 +566,13 @@ public:
         testSetContrastNotInitialized();
         testWriteBufferNotInitialized();
         testWriteBufferNullptr();
+        testWriteRegion();
+        testRotation180();
+        testStartLine();
+        testScroll();
+        testPageFlip();
+        testAsyncFlush();
+        testFrameDiff();
         printf("=== All tests passed ===\n");
     }
 };
@@ -0,0 +1,464 @@
+/**
+ * @file test_facade.cpp
+ * @brief Тесты фасада OledSsd1315 на host-заглушке STM32 HAL
+ *
+ * Все передачи заглушки (блокирующие и DMA) разбирает эмулятор GDDRAM:
+ * окно адресации 21h/22h, начальная строка 40h-7Fh, сдвиг колонок 2Ch/2Dh и
+ * данные в горизонтальном режиме. Видимая часть GDDRAM сравнивается с
+ * эталонным Gfx, на котором рисуется то же самое.
+ */
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../include/oled/OledSsd1315.hpp"
+#include "../include/oled/domain/Gfx.hpp"
+
+using namespace oled;
+
+namespace {
+
+OledSsd1315* gDisplay = nullptr;
+
+} // anonymous namespace
+
+// Прерывания HAL: как в stm32xx_it.c
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef*) {
+    gDisplay->onDmaComplete();
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef*) {
+    gDisplay->onDmaError();
+}
+
+namespace {
+
+constexpr uint16_t kWidth = 128;
+constexpr uint8_t kRamPages = 8;
+constexpr size_t kFrameSize = kWidth * kRamPages;
+
+/**
+ * @brief GDDRAM контроллера по байтам передач заглушки
+ */
+class Gddram {
+public:
+    // Разобрать передачи, которые дошли до контроллера с прошлого вызова
+    void sync() {
+        const std::vector<HalShim::Transfer>& transfers = halShim().transfers;
+        for (; seen_ < transfers.size(); ++seen_) {
+            apply(transfers[seen_].data);
+        }
+    }
+
+    // Видимые страницы (с начальной строки) совпадают с кадром
+    bool shows(const uint8_t* frame, uint16_t height) const {
+        for (int page = 0; page < height / 8; ++page) {
+            const uint8_t* row = ram_[(page + startLine_ / 8) % kRamPages];
+            if (memcmp(row, frame + page * kWidth, kWidth) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint8_t startLine() const { return startLine_; }
+
+    // Байт данных в передачах с последнего sync()
+    size_t pendingDataBytes() const {
+        const std::vector<HalShim::Transfer>& transfers = halShim().transfers;
+        size_t bytes = 0;
+        for (size_t i = seen_; i < transfers.size(); ++i) {
+            if (!transfers[i].data.empty() && transfers[i].data[0] == 0x40) {
+                bytes += transfers[i].data.size() - 1;
+            }
+        }
+        return bytes;
+    }
+
+private:
+    static size_t argCount(uint8_t c) {
+        switch (c) {
+            case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+            case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+                return 1;
+            case 0x21: case 0x22: case 0xA3:
+                return 2;
+            case 0x26: case 0x27: case 0x2C: case 0x2D:
+                return 6;
+            case 0x29: case 0x2A:
+                return 7;
+            default:
+                return 0;
+        }
+    }
+
+    void apply(const std::vector<uint8_t>& bytes) {
+        assert(!bytes.empty());
+        if (bytes[0] == 0x40) {
+            for (size_t i = 1; i < bytes.size(); ++i) {
+                writeData(bytes[i]);
+            }
+            return;
+        }
+        assert(bytes[0] == 0x00);
+        size_t i = 1;
+        while (i < bytes.size()) {
+            const uint8_t c = bytes[i++];
+            const size_t args = argCount(c);
+            assert(i + args <= bytes.size());
+            const uint8_t* a = bytes.data() + i;
+            if (c == 0x21) {
+                colStart_ = col_ = a[0];
+                colEnd_ = a[1];
+            } else if (c == 0x22) {
+                pageStart_ = page_ = a[0];
+                pageEnd_ = a[1];
+            } else if (c >= 0x40 && c <= 0x7F) {
+                startLine_ = static_cast<uint8_t>(c & 0x3F);
+            } else if (c == 0x2C || c == 0x2D) {
+                shiftColumns(c == 0x2C, a[1], a[3], a[4], a[5]);
+            }
+            i += args;
+        }
+    }
+
+    void writeData(uint8_t b) {
+        ram_[page_][col_] = b;
+        if (++col_ > colEnd_) {
+            col_ = colStart_;
+            if (++page_ > pageEnd_) {
+                page_ = pageStart_;
+            }
+        }
+    }
+
+    // 2Ch - вправо: крайняя колонка окна переходит в начало
+    void shiftColumns(bool right, uint8_t startPage, uint8_t endPage, uint8_t startCol, uint8_t endCol) {
+        for (uint8_t page = startPage; page <= endPage; ++page) {
+            uint8_t* row = ram_[page];
+            if (right) {
+                const uint8_t last = row[endCol];
+                for (int x = endCol; x > startCol; --x) row[x] = row[x - 1];
+                row[startCol] = last;
+            } else {
+                const uint8_t first = row[startCol];
+                for (int x = startCol; x < endCol; ++x) row[x] = row[x + 1];
+                row[endCol] = first;
+            }
+        }
+    }
+
+    uint8_t ram_[kRamPages][kWidth] = {};
+    uint8_t colStart_ = 0;
+    uint8_t colEnd_ = kWidth - 1;
+    uint8_t pageStart_ = 0;
+    uint8_t pageEnd_ = kRamPages - 1;
+    uint8_t col_ = 0;
+    uint8_t page_ = 0;
+    uint8_t startLine_ = 0;
+    size_t seen_ = 0;
+};
+
+class FacadeTest {
+public:
+    ~FacadeTest() { delete display_; }
+
+    void testPresentSlots() {
+        OledSsd1315& display = begin(64);
+        assert(display.flush() == OledResult::Ok);
+        ram_.sync();
+
+        // Кадр A уходит по DMA окнами изменений, рисование продолжается в свободном слоте
+        draw(display, 10, 8, 30, 20, true);
+        uint8_t frameA[kFrameSize];
+        memcpy(frameA, refBuf_, sizeof(frameA));
+        assert(display.present() == OledResult::Ok);
+        assert(!display.isDMAComplete());
+
+        // Третий буфер: кадр встаёт в очередь, следующий его заменяет
+        draw(display, 70, 20, 40, 30, true);
+        assert(display.present() == OledResult::Ok);
+        draw(display, 0, 60, 128, 4, true);
+        uint8_t frameC[kFrameSize];
+        memcpy(frameC, refBuf_, sizeof(frameC));
+        assert(display.present() == OledResult::Ok);
+
+        // A - только свои колонки; окончание A запускает C из onDmaComplete()
+        assert(completeUntilShown(frameA, 64) == 3 * 30);
+        assert(!display.isDMAComplete());
+
+        // B отброшен, но его окна уходят вместе с C
+        while (halShimComplete()) {
+        }
+        assert(ram_.pendingDataBytes() == 5 * 40 + kWidth);
+        ram_.sync();
+        assert(ram_.shows(frameC, 64));
+        assert(display.isDMAComplete() && display.getLastResult() == OledResult::Ok);
+
+        // Кадр из очереди не запустился: ошибка, следующий present() передаёт кадр заново
+        draw(display, 0, 0, 128, 8, true);
+        assert(display.present() == OledResult::Ok);
+        draw(display, 40, 30, 8, 8, false);
+        uint8_t frameE[kFrameSize];
+        memcpy(frameE, refBuf_, sizeof(frameE));
+        assert(display.present() == OledResult::Ok);
+        // Страница 0 на всю ширину: окно и одна передача данных, E стартует после неё
+        assert(halShimComplete());
+        halShim().failStart = true;
+        assert(halShimComplete());
+        halShim().failStart = false;
+        assert(display.isDMAComplete());
+        assert(display.getLastResult() == OledResult::I2cError);
+        assert(strcmp(display.getLastError(), "DMA transfer start failed") == 0);
+
+        assert(display.present() == OledResult::Ok);
+        while (halShimComplete()) {
+        }
+        ram_.sync();
+        assert(ram_.shows(frameE, 64));
+
+        printf("[PASS] testPresentSlots\n");
+    }
+
+    void testDmaErrors() {
+        OledSsd1315& display = begin(64);
+
+        // Ошибка шины на окне flushDMA(): кадр помечается изменённым целиком
+        draw(display, 5, 5, 20, 20, true);
+        draw(display, 90, 40, 10, 10, true);
+        assert(display.flushDMA() == OledResult::Ok);
+        assert(halShimComplete());
+        assert(halShimComplete(false));
+        assert(display.isDMAComplete());
+        assert(display.getLastResult() == OledResult::I2cError);
+        assert(display.flush() == OledResult::Ok);
+        ram_.sync();
+        assert(ram_.shows(refBuf_, 64));
+
+        // Ошибка шины на кадре present()
+        draw(display, 50, 0, 20, 64, true);
+        assert(display.present() == OledResult::Ok);
+        assert(halShimComplete(false));
+        assert(display.isDMAComplete());
+        assert(display.getLastResult() == OledResult::I2cError);
+        assert(display.present() == OledResult::Ok);
+        while (halShimComplete()) {
+        }
+        ram_.sync();
+        assert(ram_.shows(refBuf_, 64));
+
+        // Окна flushDMA() не пишут в GDDRAM во время аппаратной прокрутки
+        assert(display.scrollHorizontal(ScrollDirection::Left, 0, 7, ScrollInterval::Frames2) == OledResult::Ok);
+        draw(display, 0, 0, 4, 4, true);
+        assert(display.flushDMA() == OledResult::Busy);
+        assert(strcmp(display.getLastError(), "scroll active") == 0);
+        assert(display.isDMAComplete());
+        assert(display.stopScroll() == OledResult::Ok);
+        assert(display.flushDMA() == OledResult::Ok);
+        while (halShimComplete()) {
+        }
+        ram_.sync();
+        assert(ram_.shows(refBuf_, 64));
+
+        printf("[PASS] testDmaErrors\n");
+    }
+
+    void testViewOriginQueued() {
+        OledSsd1315& display = begin(64);
+        for (int page = 0; page < kRamPages; ++page) {
+            draw(display, page * 16, page * 8, 16, 8, true);
+        }
+        assert(display.flush() == OledResult::Ok);
+        ram_.sync();
+
+        // Кадр в полёте, прокрутка на 2 страницы: SET_START_LINE уходит с кадром из очереди
+        draw(display, 100, 0, 4, 8, true);
+        assert(display.present() == OledResult::Ok);
+        assert(display.setViewOrigin(2) == OledResult::Ok);
+        scrollReference(2);
+        draw(display, 0, 48, 128, 16, false);
+        draw(display, 20, 50, 30, 10, true);
+        assert(display.present() == OledResult::Ok);
+        assert(!display.isDMAComplete());
+        while (halShimComplete()) {
+        }
+        ram_.sync();
+        assert(ram_.startLine() == 16);
+        assert(ram_.shows(refBuf_, 64));
+        assert(display.isDMAComplete() && display.getLastResult() == OledResult::Ok);
+
+        // Строка отправлена: пустой present() шину не занимает
+        const size_t transfers = halShim().transfers.size();
+        assert(display.present() == OledResult::Ok);
+        assert(halShim().transfers.size() == transfers && display.isDMAComplete());
+
+        // Кадр со строкой не стартовал из onDmaComplete(): строка уходит со следующим
+        draw(display, 0, 0, 128, 8, false);
+        assert(display.present() == OledResult::Ok);
+        assert(display.setViewOrigin(5) == OledResult::Ok);
+        scrollReference(3);
+        assert(display.present() == OledResult::Ok);
+        assert(halShimComplete());
+        halShim().failStart = true;
+        assert(halShimComplete());
+        halShim().failStart = false;
+        assert(display.getLastResult() == OledResult::I2cError);
+        ram_.sync();
+        assert(ram_.startLine() == 16);
+
+        assert(display.present() == OledResult::Ok);
+        while (halShimComplete()) {
+        }
+        ram_.sync();
+        assert(ram_.startLine() == 40);
+        assert(ram_.shows(refBuf_, 64));
+
+        printf("[PASS] testViewOriginQueued\n");
+    }
+
+    void testScrollContent() {
+        OledSsd1315& display = begin(64);
+        // Своя картинка в каждой колонке: видно, куда ушла каждая
+        for (int x = 0; x < kWidth; ++x) {
+            draw(display, x, 16 + (x * 7) % 29, 1, 1 + x % 4, true);
+        }
+        assert(display.flush() == OledResult::Ok);
+        ram_.sync();
+        assert(ram_.shows(refBuf_, 64));
+
+        // Бегущая строка: сдвиг контроллером, затем одна новая колонка
+        for (int step = 0; step < 10; ++step) {
+            const ScrollDirection dir = (step < 6) ? ScrollDirection::Left : ScrollDirection::Right;
+            assert(display.scrollContent(dir, 2, 5, 8, 119) == OledResult::Ok);
+            shiftReference(dir == ScrollDirection::Right, 2, 5, 8, 119);
+
+            // Без новой колонки ушедшая за край появляется с другой стороны окна
+            const bool redraw = step % 4 != 1;
+            if (redraw) {
+                const int x = (dir == ScrollDirection::Left) ? 119 : 8;
+                draw(display, x, 16, 1, 32, step % 3 == 0);
+            }
+            assert(display.flush() == OledResult::Ok);
+            assert(ram_.pendingDataBytes() == (redraw ? 4u : 0u));
+            ram_.sync();
+            assert(ram_.shows(refBuf_, 64));
+        }
+
+        // Буфер фасада повторил каждый сдвиг: кадр целиком даёт то же изображение
+        display.invalidate();
+        assert(display.flush() == OledResult::Ok);
+        ram_.sync();
+        assert(ram_.shows(refBuf_, 64));
+
+        printf("[PASS] testScrollContent\n");
+    }
+
+    void testPageFlipUnion() {
+        OledSsd1315& display = begin(32);
+        assert(display.setPageFlip(true) == OledResult::Ok);
+
+        // Скрытая половина отстаёт на кадр: каждый flush() догоняет и её
+        uint32_t seed = 7;
+        for (int frame = 0; frame < 24; ++frame) {
+            const int shapes = 1 + frame % 3;
+            for (int i = 0; i < shapes; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                const int x = static_cast<int>((seed >> 8) % 120);
+                const int y = static_cast<int>((seed >> 16) % 28);
+                const int w = 1 + static_cast<int>((seed >> 4) % 8);
+                const int h = 1 + static_cast<int>((seed >> 24) % 4);
+                draw(display, x, y, w, h, (seed >> 30) != 0);
+            }
+            assert(display.flush() == OledResult::Ok);
+            if (frame > 1) {
+                assert(ram_.pendingDataBytes() < kWidth * 4);
+            }
+            ram_.sync();
+            assert(ram_.shows(refBuf_, 32));
+        }
+
+        printf("[PASS] testPageFlipUnion\n");
+    }
+
+    void runAll() {
+        printf("=== OledSsd1315 Facade Tests ===\n");
+        testPresentSlots();
+        testDmaErrors();
+        testViewOriginQueued();
+        testScrollContent();
+        testPageFlipUnion();
+        printf("=== All tests passed ===\n");
+    }
+
+private:
+    OledSsd1315& begin(uint16_t height) {
+        halShim() = HalShim();
+        ram_ = Gddram();
+        delete display_;
+        display_ = new OledSsd1315(&hi2c_);
+        gDisplay = display_;
+
+        OledConfig cfg;
+        cfg.height = height;
+        assert(display_->begin(cfg) == OledResult::Ok);
+        memset(refBuf_, 0, sizeof(refBuf_));
+        ref_.init(refBuf_, kWidth, height);
+        return *display_;
+    }
+
+    // Завершать передачи по одной, пока GDDRAM не покажет кадр; байт данных или 0
+    size_t completeUntilShown(const uint8_t* frame, uint16_t height) {
+        size_t bytes = 0;
+        while (halShimComplete()) {
+            bytes += ram_.pendingDataBytes();
+            ram_.sync();
+            if (ram_.shows(frame, height)) {
+                return bytes;
+            }
+        }
+        return 0;
+    }
+
+    void draw(OledSsd1315& display, int x, int y, int w, int h, bool color) {
+        display.rectFill(x, y, w, h, color);
+        ref_.rectFill(x, y, w, h, color);
+    }
+
+    void shiftReference(bool right, uint8_t startPage, uint8_t endPage, uint8_t startCol, uint8_t endCol) {
+        for (uint8_t page = startPage; page <= endPage; ++page) {
+            uint8_t* row = refBuf_ + page * kWidth;
+            uint8_t moved[kWidth];
+            memcpy(moved, row, kWidth);
+            for (int x = startCol; x <= endCol; ++x) {
+                const int from = right ? (x == startCol ? endCol : x - 1) : (x == endCol ? startCol : x + 1);
+                moved[x] = row[from];
+            }
+            memcpy(row, moved, kWidth);
+        }
+    }
+
+    // setViewOrigin(): логическая страница p показывает прежнюю страницу p + pages
+    void scrollReference(int pages) {
+        uint8_t moved[kFrameSize];
+        for (int page = 0; page < kRamPages; ++page) {
+            memcpy(moved + page * kWidth, refBuf_ + ((page + pages) % kRamPages) * kWidth, kWidth);
+        }
+        memcpy(refBuf_, moved, sizeof(moved));
+    }
+
+    I2C_HandleTypeDef hi2c_{};
+    OledSsd1315* display_ = nullptr;
+    Gddram ram_;
+    uint8_t refBuf_[kFrameSize] = {};
+    Gfx ref_;
+};
+
+} // anonymous namespace
+
+int main() {
+    FacadeTest test;
+    test.runAll();
+    return 0;
+}
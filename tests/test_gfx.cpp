@@ -9,7 +9,10 @@
 
 #include <cassert>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 // Для host-тестирования определяем минимальную конфигурацию
 #define OLED_SSD1315_ENABLE 1
@@ -18,11 +21,43 @@
 #define OLED_ENABLED 1
 
 #include "../include/oled/domain/Gfx.hpp"
+#include "../include/oled/domain/ImageImport.hpp"
+#include "../src/gfx/Font5x7.hpp"
+#include "../src/gfx/GlyphIndex5x7.hpp"
 
 using namespace oled;
 
 namespace {
 
+// Тестовый шрифт: 'A', 'B' (буква V), 'C' (буква g с выносным элементом)
+constexpr uint8_t kTinyPacked[] = {
+    0x7E, 0x92, 0xF8, 0x07, 0x06, 0x62, 0x07, 0x6F, 0xFA, 0x03,
+};
+constexpr uint8_t kTinyRle[] = {
+    0x00, 0x85, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x02, 0x84, 0x82, 0x05,
+    0x81, 0x05, 0x80, 0x02, 0x81, 0x00, 0x82, 0x02, 0x83, 0x00, 0x81, 0x01,
+    0x80, 0x00, 0x86,
+};
+constexpr FontGlyph kTinyPackedGlyphs[] = {
+    {0, 4, 6, 5, 0, 0},
+    {3, 5, 6, 6, 0, 0},
+    {7, 3, 6, 4, 0, 2},
+};
+constexpr FontGlyph kTinyRleGlyphs[] = {
+    {0, 4, 6, 5, 0, 0},
+    {10, 5, 6, 6, 0, 0},
+    {20, 3, 6, 4, 0, 2},
+};
+constexpr FontKernPair kTinyKerning[] = {
+    {0, 1, -1},  // A B
+};
+constexpr Font kTinyFont = {
+    kTinyPacked, kTinyPackedGlyphs, 'A', 3, 8, 6, FontEncoding::Packed, kTinyKerning, 1
+};
+constexpr Font kTinyFontRle = {
+    kTinyRle, kTinyRleGlyphs, 'A', 3, 8, 6, FontEncoding::Rle, kTinyKerning, 1
+};
+
 constexpr uint16_t kTestWidth = 128;
 constexpr uint16_t kTestHeight = 64;
 constexpr size_t kBufferSize = (kTestWidth * kTestHeight) / 8;
@@ -112,6 +147,52 @@ public:
         printf("[PASS] testLine\n");
     }
 
+    void testLineClipping() {
+        uint8_t reference[kBufferSize];
+        uint32_t seed = 777;
+        auto next = [&seed](int range, int bias) {
+            seed = seed * 1103515245u + 12345u;
+            return static_cast<int>((seed >> 8) % static_cast<uint32_t>(range)) - bias;
+        };
+
+        for (int i = 0; i < 500; ++i) {
+            // Часть отрезков далеко за экраном
+            const int range = (i % 4 == 0) ? 4000 : 200;
+            int x0 = next(range, range / 2 - 64);
+            int y0 = next(range, range / 2 - 32);
+            int x1 = next(range, range / 2 - 64);
+            int y1 = next(range, range / 2 - 32);
+
+            lineReference(reference, x0, y0, x1, y1);
+            gfx_.clear();
+            gfx_.clearDirty();
+            gfx_.line(x0, y0, x1, y1, true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+            assertDirtyCovers(buffer_);
+
+            // Порядок концов не важен
+            gfx_.clear();
+            gfx_.line(x1, y1, x0, y0, true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+            // Стирание снимает ровно те же пиксели
+            gfx_.fill(true);
+            gfx_.line(x0, y0, x1, y1, false);
+            for (size_t k = 0; k < kBufferSize; ++k) {
+                assert(buffer_[k] == static_cast<uint8_t>(~reference[k]));
+            }
+        }
+
+        // Очень длинная линия через весь экран
+        lineReference(reference, -30000, -15000, 30000, 15000);
+        gfx_.clear();
+        gfx_.line(-30000, -15000, 30000, 15000, true);
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        assert(getPixel(buffer_, 64, 32));
+
+        printf("[PASS] testLineClipping\n");
+    }
+
     void testRect() {
         gfx_.clear();
 
@@ -127,6 +208,1047 @@ public:
         printf("[PASS] testRect\n");
     }
 
+    void testRectFill() {
+        gfx_.clear();
+
+        // Область через границу страниц: строки 6..9, колонки 2..4
+        gfx_.rectFill(2, 6, 3, 4, true);
+        for (int x = 2; x < 5; ++x) {
+            assert(buffer_[x] == 0xC0);
+            assert(buffer_[kTestWidth + x] == 0x03);
+        }
+        assert(buffer_[1] == 0x00);
+        assert(buffer_[5] == 0x00);
+
+        // Стирание части залитой области
+        gfx_.fill(true);
+        gfx_.rectFill(0, 8, kTestWidth, 8, false);
+        for (int x = 0; x < kTestWidth; ++x) {
+            assert(buffer_[x] == 0xFF);
+            assert(buffer_[kTestWidth + x] == 0x00);
+            assert(buffer_[2 * kTestWidth + x] == 0xFF);
+        }
+
+        // Обрезка по границам (включая отрицательные координаты)
+        gfx_.clear();
+        gfx_.rectFill(-5, -5, 7, 7, true);
+        assert(buffer_[0] == 0x03);
+        assert(buffer_[1] == 0x03);
+        assert(buffer_[2] == 0x00);
+        gfx_.rectFill(kTestWidth - 1, kTestHeight - 1, 10, 10, true);
+        assert(buffer_[kBufferSize - 1] == 0x80);
+
+        // Нулевые и отрицательные размеры игнорируются
+        gfx_.clear();
+        gfx_.rectFill(10, 10, 0, 5, true);
+        gfx_.rectFill(10, 10, 5, -1, true);
+        for (size_t i = 0; i < kBufferSize; ++i) {
+            assert(buffer_[i] == 0x00);
+        }
+
+        printf("[PASS] testRectFill\n");
+    }
+
+    void testDirtyTracking() {
+        gfx_.clearDirty();
+        assert(!gfx_.isDirty());
+
+        uint8_t x0 = 0;
+        uint8_t x1 = 0;
+
+        // Пиксель отмечает одну колонку одной страницы
+        gfx_.pixel(5, 10, true);
+        assert(gfx_.isDirty());
+        assert(gfx_.pageDirtyRange(1, x0, x1));
+        assert(x0 == 5 && x1 == 5);
+        assert(!gfx_.pageDirtyRange(0, x0, x1));
+
+        // Диапазон расширяется
+        gfx_.rectFill(20, 8, 4, 12, true);
+        assert(gfx_.pageDirtyRange(1, x0, x1));
+        assert(x0 == 5 && x1 == 23);
+        assert(gfx_.pageDirtyRange(2, x0, x1));
+        assert(x0 == 20 && x1 == 23);
+
+        // Рисование за пределами буфера ничего не отмечает
+        gfx_.clearDirty();
+        gfx_.pixel(-1, 0, true);
+        gfx_.rectFill(kTestWidth, 0, 5, 5, true);
+        assert(!gfx_.isDirty());
+
+        // clear() отмечает весь экран
+        gfx_.clear();
+        for (uint8_t page = 0; page < kTestHeight / 8; ++page) {
+            assert(gfx_.pageDirtyRange(page, x0, x1));
+            assert(x0 == 0 && x1 == kTestWidth - 1);
+        }
+
+        // Холст выше MAX_PAGES: лишние страницы рисуются, но не отслеживаются
+        static uint8_t tallBuf[kTestWidth * kTestWidth / 8];
+        Gfx tall;
+        tall.init(tallBuf, kTestWidth, kTestWidth);
+        tall.pixel(5, kTestWidth - 8, true);
+        assert(tallBuf[(kTestWidth / 8 - 1) * kTestWidth + 5] == 0x01);
+        assert(!tall.isDirty());
+        assert(!tall.pageDirtyRange(kTestWidth / 8 - 1, x0, x1));
+        tall.pixel(7, 3, true);
+        assert(tall.isDirty());
+        assert(tall.pageDirtyRange(0, x0, x1) && x0 == 7 && x1 == 7);
+
+        printf("[PASS] testDirtyTracking\n");
+    }
+
+    void testGlyphBlit() {
+        // Эталон: попиксельная отрисовка в отдельный буфер
+        uint8_t reference[kBufferSize];
+        Gfx ref;
+        ref.init(reference, kTestWidth, kTestHeight);
+
+        const char chars[] = {'A', 'g', '#', '~'};
+        const int xs[] = {0, 60, kTestWidth - 3, -2};
+        const bool colors[] = {true, false};
+
+        // Масштабы 1..4 идут через таблицы, 5 - через блоки rectFill
+        for (uint8_t scale = 1; scale <= 5; ++scale) {
+            for (bool color : colors) {
+                for (char c : chars) {
+                    for (int x : xs) {
+                        for (int y = -8 * scale; y <= kTestHeight; ++y) {
+                            gfx_.fill(!color);
+                            ref.fill(!color);
+
+                            gfx_.drawChar(x, y, c, color, scale);
+                            drawReferenceChar(ref, x, y, c, color, scale);
+
+                            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+                        }
+                    }
+                }
+            }
+        }
+
+        printf("[PASS] testGlyphBlit\n");
+    }
+
+    void testBlit() {
+        // Битмап 13x11 в формате страниц (2 страницы по 13 байт)
+        constexpr int bw = 13;
+        constexpr int bh = 11;
+        uint8_t bitmap[bw * 2];
+        for (int i = 0; i < bw * 2; ++i) {
+            bitmap[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+
+        const RasterOp ops[] = {RasterOp::Copy, RasterOp::Or, RasterOp::And,
+                                RasterOp::Xor, RasterOp::AndNot, RasterOp::Not};
+        const int positions[][2] = {{0, 0}, {5, 3}, {-4, -6}, {120, 58}, {30, 17}};
+        uint8_t expected[kBufferSize];
+
+        for (RasterOp op : ops) {
+            for (const auto& pos : positions) {
+                fillPattern();
+                memcpy(expected, buffer_, kBufferSize);
+
+                for (int by = 0; by < bh; ++by) {
+                    for (int bx = 0; bx < bw; ++bx) {
+                        bool srcBit = (bitmap[(by / 8) * bw + bx] >> (by % 8)) & 0x01;
+                        setRefPixel(expected, pos[0] + bx, pos[1] + by, op, srcBit);
+                    }
+                }
+
+                gfx_.blit(pos[0], pos[1], bw, bh, bitmap, op);
+                assert(memcmp(buffer_, expected, kBufferSize) == 0);
+            }
+        }
+
+        printf("[PASS] testBlit\n");
+    }
+
+    void testCopyRectOverlap() {
+        // Перекрывающиеся копии во всех направлениях, включая невыровненные по странице
+        const int moves[][2] = {{3, 0}, {-3, 0}, {0, 5}, {0, -5}, {7, 9}, {-9, -13}, {1, 1}};
+        uint8_t snapshot[kBufferSize];
+        uint8_t expected[kBufferSize];
+
+        for (const auto& mv : moves) {
+            fillPattern();
+            memcpy(snapshot, buffer_, kBufferSize);
+            memcpy(expected, buffer_, kBufferSize);
+
+            const int sx = 20, sy = 10, w = 40, h = 30;
+            for (int y = 0; y < h; ++y) {
+                for (int x = 0; x < w; ++x) {
+                    setRefPixel(expected, sx + mv[0] + x, sy + mv[1] + y, RasterOp::Copy,
+                                getPixel(snapshot, sx + x, sy + y));
+                }
+            }
+
+            gfx_.copyRect(sx, sy, w, h, sx + mv[0], sy + mv[1]);
+            assert(memcmp(buffer_, expected, kBufferSize) == 0);
+        }
+
+        printf("[PASS] testCopyRectOverlap\n");
+    }
+
+    void testScroll() {
+        // Области с неполными страницами, чистые сдвиги по осям и диагональ
+        struct Case { int x, y, w, h, dx, dy; bool fill; };
+        const Case cases[] = {
+            {0, 0, 128, 64, 7, 0, false},  {0, 0, 128, 64, -1, 0, true},
+            {10, 3, 50, 21, 4, 0, true},   {10, 3, 50, 21, -9, 0, false},
+            {0, 0, 128, 64, 0, 8, false},  {0, 0, 128, 64, 0, -16, true},
+            {5, 13, 70, 40, 0, 3, false},  {5, 13, 70, 40, 0, -11, true},
+            {5, 13, 70, 40, 6, 5, true},   {33, 1, 17, 60, -2, -7, false},
+            {0, 60, 128, 4, 0, 1, false},  {20, 20, 1, 1, 0, 0, true},
+            {100, 40, 50, 50, -3, 2, true},  // Обрезка по краю экрана
+            {8, 8, 16, 16, 16, 0, true},     // Сдвиг не меньше области - заливка
+        };
+        uint8_t snapshot[kBufferSize];
+        uint8_t expected[kBufferSize];
+
+        for (const Case& c : cases) {
+            fillPattern();
+            memcpy(snapshot, buffer_, kBufferSize);
+            memcpy(expected, buffer_, kBufferSize);
+
+            const int x0 = std::max(c.x, 0);
+            const int y0 = std::max(c.y, 0);
+            const int x1 = std::min(c.x + c.w, static_cast<int>(kTestWidth));
+            const int y1 = std::min(c.y + c.h, static_cast<int>(kTestHeight));
+            for (int y = y0; y < y1; ++y) {
+                for (int x = x0; x < x1; ++x) {
+                    const int sx = x - c.dx;
+                    const int sy = y - c.dy;
+                    const bool inside = sx >= x0 && sx < x1 && sy >= y0 && sy < y1;
+                    setRefPixel(expected, x, y, RasterOp::Copy, inside ? getPixel(snapshot, sx, sy) : c.fill);
+                }
+            }
+
+            gfx_.clearDirty();
+            gfx_.scroll(c.x, c.y, c.w, c.h, c.dx, c.dy, c.fill);
+            assert(memcmp(buffer_, expected, kBufferSize) == 0);
+
+            // Dirty - не шире области
+            for (int page = 0; page < kTestHeight / 8; ++page) {
+                uint8_t d0 = 0;
+                uint8_t d1 = 0;
+                if (gfx_.pageDirtyRange(static_cast<uint8_t>(page), d0, d1)) {
+                    assert(page >= y0 / 8 && page <= (y1 - 1) / 8);
+                    assert(d0 >= x0 && d1 < x1);
+                }
+            }
+        }
+
+        printf("[PASS] testScroll\n");
+    }
+
+    void testSetBuffer() {
+        static uint8_t other[kBufferSize];
+        memset(other, 0, kBufferSize);
+        gfx_.clear();
+        gfx_.clearDirty();
+        gfx_.setCursor(10, 20);
+        gfx_.pixel(1, 1, true);
+
+        // Рисование продолжается в новом буфере, состояние контекста прежнее
+        gfx_.setBuffer(other);
+        assert(gfx_.buffer() == other);
+        assert(gfx_.isDirty());
+        gfx_.pixel(2, 9, true);
+        assert(other[kTestWidth + 2] == 0x02);
+        assert(buffer_[kTestWidth + 2] == 0x00);
+        gfx_.print("A");  // Курсор (10, 20) сохранился
+        bool glyph = false;
+        for (int x = 10; x < 15; ++x) {
+            glyph = glyph || other[2 * kTestWidth + x] || other[3 * kTestWidth + x];
+            assert(buffer_[2 * kTestWidth + x] == 0 && buffer_[3 * kTestWidth + x] == 0);
+        }
+        assert(glyph);
+
+        gfx_.setBuffer(buffer_);
+        printf("[PASS] testSetBuffer\n");
+    }
+
+    void testPageBitmap() {
+        // Стрелка 10x9, MSB = левый пиксель, 2 байта на строку
+        static constexpr uint8_t kArrowRows[] = {
+            0x08, 0x00,
+            0x0C, 0x00,
+            0x0E, 0x00,
+            0xFF, 0x00,
+            0xFF, 0xC0,
+            0xFF, 0x00,
+            0x0E, 0x00,
+            0x0C, 0x00,
+            0x08, 0x00,
+        };
+        constexpr auto kArrow = toPageBitmap<10, 9>(kArrowRows);
+        static_assert(kArrow.width == 10 && kArrow.height == 9, "metadata");
+        static_assert(kArrow.pages == 2 && kArrow.size == 20, "page count");
+        static_assert(kArrow.data[0] == 0x38, "column 0, page 0");
+        static_assert(kArrow.data[4] == 0xFF, "column 4, page 0");
+        static_assert(kArrow.data[9] == 0x10, "column 9, page 0");
+        static_assert(kArrow.data[10 + 4] == 0x01, "column 4, page 1");
+        static_assert(kArrow.data[10 + 8] == 0x00, "column 8, page 1");
+
+        // Тот же битмап в порядке XBM (LSB = левый пиксель)
+        static constexpr uint8_t kArrowXbm[] = {
+            0x10, 0x00,
+            0x30, 0x00,
+            0x70, 0x00,
+            0xFF, 0x00,
+            0xFF, 0x03,
+            0xFF, 0x00,
+            0x70, 0x00,
+            0x30, 0x00,
+            0x10, 0x00,
+        };
+        constexpr auto kArrowLsb = toPageBitmap<10, 9, BitOrder::LsbFirst>(kArrowXbm);
+        assert(kArrowLsb.data == kArrow.data);
+
+        // Результат blit совпадает с попиксельной отрисовкой строк
+        gfx_.clear();
+        gfx_.blit(3, 5, kArrow);
+        for (int y = 0; y < 9; ++y) {
+            for (int x = 0; x < 10; ++x) {
+                bool on = (kArrowRows[y * 2 + x / 8] >> (7 - x % 8)) & 0x01;
+                assert(getPixel(buffer_, 3 + x, 5 + y) == on);
+            }
+        }
+
+        printf("[PASS] testPageBitmap\n");
+    }
+
+    void testProportionalFont() {
+        const char* expected[] = {
+            "..##.#...#..",
+            ".#..##...#..",
+            ".#..##...#.###",
+            ".####.#.#..#.#",
+            ".#..#.#.#..#.#",
+            ".#..#..#...###",
+            ".............#",
+            "...........###",
+        };
+
+        gfx_.clear();
+        gfx_.setFont(&kTinyFont);
+        gfx_.setCursor(1, 1);
+        gfx_.print("ABC");
+
+        for (int y = 0; y < 8; ++y) {
+            const char* row = expected[y];
+            for (int x = 0; x < 16; ++x) {
+                bool on = x < static_cast<int>(strlen(row)) && row[x] == '#';
+                assert(getPixel(buffer_, x, y + 1) == on);
+            }
+        }
+
+        // RLE-версия того же шрифта рисует то же самое
+        uint8_t packed[kBufferSize];
+        memcpy(packed, buffer_, kBufferSize);
+        gfx_.clear();
+        gfx_.setFont(&kTinyFontRle);
+        gfx_.setCursor(1, 1);
+        gfx_.print("ABC");
+        assert(memcmp(packed, buffer_, kBufferSize) == 0);
+
+        // Перенос по ширине глифа и шаг строки шрифта
+        gfx_.clear();
+        gfx_.setCursor(kTestWidth - 7, 0);
+        gfx_.print("CA");
+        assert(getPixel(buffer_, kTestWidth - 6, 2 + 5));   // 'C' в первой строке
+        assert(getPixel(buffer_, 1, 8 + 3));                 // 'A' перенесена на строку 8
+
+        gfx_.setFont(nullptr);
+        printf("[PASS] testProportionalFont\n");
+    }
+
+    void testUnicodeRanges() {
+        // Границы каждого диапазона находятся, соседние пропуски - нет
+        for (size_t i = 0; i < GLYPH_RANGE_COUNT_5X7; ++i) {
+            const GlyphRange& r = GLYPH_RANGES_5X7[i];
+            const uint8_t* bank = GLYPH_BANKS_5X7[r.bank];
+            assert(findGlyph5x7(r.first) == bank + r.base * FONT_WIDTH);
+            assert(findGlyph5x7(r.first + r.count - 1) == bank + (r.base + r.count - 1) * FONT_WIDTH);
+            bool gapBefore = i > 0 && GLYPH_RANGES_5X7[i - 1].first + GLYPH_RANGES_5X7[i - 1].count < r.first;
+            if (gapBefore) {
+                assert(findGlyph5x7(r.first - 1) == nullptr);
+            }
+        }
+        assert(findGlyph5x7(0x1F) == nullptr);
+        assert(findGlyph5x7(0x20AC) == nullptr);     // € нет в шрифте
+        assert(findGlyph5x7(0x10FFFF) == nullptr);
+
+        // Кириллица через таблицу: Ё и Я как раньше
+        assert(findGlyph5x7(0x0401) == FONT_CYRILLIC_YO_UPPER);
+        assert(findGlyph5x7(0x042F) == &FONT_CYRILLIC_UPPER[31 * FONT_WIDTH]);
+
+        // 2-, 3- и 4-байтовый UTF-8 рисуются своими глифами
+        const char* samples[] = {"\xC3\xA9", "\xCE\xA9", "\xD0\x87", "\xE2\x94\xBC", "\xF0\x9F\x94\x8B"};
+        const uint32_t codepoints[] = {0x00E9, 0x03A9, 0x0407, 0x253C, 0x1F50B};
+        for (size_t i = 0; i < 5; ++i) {
+            gfx_.clear();
+            gfx_.setCursor(0, 0);
+            gfx_.print(samples[i]);
+            const uint8_t* glyph = findGlyph5x7(codepoints[i]);
+            assert(glyph != nullptr);
+            for (int col = 0; col < FONT_WIDTH; ++col) {
+                assert(buffer_[col] == (glyph[col] & 0x7F));
+            }
+        }
+
+        // 🔋 и U+E002 - один и тот же глиф
+        assert(findGlyph5x7(0x1F50B) == findGlyph5x7(0xE002));
+
+        printf("[PASS] testUnicodeRanges\n");
+    }
+
+    void testTextLayout() {
+        // Ширина без отрисовки: 6 пикселей на символ без последнего интервала
+        assert(gfx_.measureText("Hello") == 29);
+        assert(gfx_.measureText("ab\nabcd") == 23);
+        assert(gfx_.measureText("") == 0);
+
+        TextLayout layout;
+
+        // Перенос по словам
+        gfx_.layoutText(layout, "one two three", 42);
+        assert(layout.lineCount() == 2);
+        assert(layout.line(0).start == 0 && layout.line(0).length == 7 && layout.line(0).width == 41);
+        assert(layout.line(1).start == 8 && layout.line(1).length == 5 && layout.line(1).width == 29);
+        assert(layout.height() == 16);
+        assert(!layout.truncated());
+
+        // Слово шире строки делится по символам
+        gfx_.layoutText(layout, "abcdefghij", 30);
+        assert(layout.lineCount() == 2);
+        assert(layout.line(0).length == 5 && layout.line(1).start == 5);
+
+        // Многоточие: "abc" + "..." укладываются в 40 пикселей
+        gfx_.layoutText(layout, "abcdefghij", 40, TextAlign::Left, 1);
+        assert(layout.lineCount() == 1 && layout.truncated());
+        assert(layout.line(0).length == 3 && layout.line(0).width == 35);
+
+        // Лишние строки после '\n' тоже обрезаются многоточием
+        gfx_.layoutText(layout, "a\nb\nc", 0, TextAlign::Left, 2);
+        assert(layout.lineCount() == 2 && layout.truncated());
+
+        // Отрисовка совпадает с print() в выровненной позиции, курсор не меняется
+        uint8_t reference[kBufferSize];
+        Gfx ref;
+        ref.init(reference, kTestWidth, kTestHeight);
+
+        gfx_.layoutText(layout, "Hi", kTestWidth, TextAlign::Center);
+        assert(layout.line(0).x == (kTestWidth - 11) / 2);
+        gfx_.clear();
+        gfx_.setCursor(3, 4);
+        gfx_.drawText(layout, 0, 10);
+        ref.clear();
+        ref.setCursor((kTestWidth - 11) / 2, 10);
+        ref.print("Hi");
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        gfx_.layoutText(layout, "abcdefghij", 40, TextAlign::Right, 1);
+        assert(layout.line(0).x == 5 && layout.left() == 5 && layout.width() == 35);
+        gfx_.clear();
+        gfx_.drawText(layout, 0, 0);
+        ref.clear();
+        ref.setCursor(5, 0);
+        ref.print("abc...");
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        // Повторная отрисовка той же разметки в другом месте
+        gfx_.clear();
+        gfx_.drawText(layout, 20, 30);
+        ref.clear();
+        ref.setCursor(25, 30);
+        ref.print("abc...");
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        // Пропорциональный шрифт: метрики и кернинг шрифта
+        gfx_.setFont(&kTinyFont);
+        assert(gfx_.measureText("AB") == 9);
+        gfx_.layoutText(layout, "AB", 20, TextAlign::Right);
+        gfx_.setFont(nullptr);
+        gfx_.clear();
+        gfx_.drawText(layout, 0, 0);
+        ref.setFont(&kTinyFont);
+        ref.clear();
+        ref.setCursor(11, 0);
+        ref.print("AB");
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        gfx_.setCursor(0, 0);
+        printf("[PASS] testTextLayout\n");
+    }
+
+    void testUtf8Print() {
+        uint8_t reference[kBufferSize];
+        Gfx ref;
+        ref.init(reference, kTestWidth, kTestHeight);
+
+        // Пачки ASCII и посимвольный вывод дают одинаковую картинку (включая перенос)
+        const char* text = "The quick brown fox jumps over the lazy dog 0123456789 "
+                           "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, "
+                           "\xCE\xB1\xCE\xB2 \xF0\x9F\x94\x8B ~~~ long ASCII tail 1234567890";
+        for (uint8_t scale = 1; scale <= 2; ++scale) {
+            gfx_.clear();
+            gfx_.setTextSize(scale);
+            gfx_.setCursor(0, 0);
+            gfx_.print(text);
+
+            ref.clear();
+            ref.setTextSize(scale);
+            ref.setCursor(0, 0);
+            char one[5];
+            for (const char* p = text; *p;) {
+                size_t n = 1;
+                while ((static_cast<uint8_t>(p[n]) & 0xC0) == 0x80) ++n;
+                memcpy(one, p, n);
+                one[n] = '\0';
+                ref.print(one);
+                p += n;
+            }
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+        gfx_.setTextSize(1);
+        ref.setTextSize(1);
+
+        // Недопустимые последовательности пропускаются без сдвига курсора
+        const char* invalid[] = {
+            "\xC0\xAF",             // overlong '/'
+            "\xE0\x80\xAF",         // overlong 3 байта
+            "\xF0\x80\x80\xAF",     // overlong 4 байта
+            "\xED\xA0\x80",         // суррогат U+D800
+            "\xF4\x90\x80\x80",     // больше U+10FFFF
+            "\xF8\x88\x80\x80\x80", // 5 байт
+            "\x80\xBF",             // продолжения без ведущего байта
+            "\xE2\x94",             // обрезанная последовательность
+        };
+        ref.clear();
+        ref.setCursor(0, 0);
+        ref.print("A");
+        for (const char* bad : invalid) {
+            char str[16];
+            snprintf(str, sizeof(str), "%sA", bad);
+            gfx_.clear();
+            gfx_.setCursor(0, 0);
+            gfx_.print(str);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+
+        // Граничные допустимые: U+10FFFF (глифа нет - пустое место), U+0080
+        gfx_.clear();
+        gfx_.setCursor(0, 0);
+        gfx_.print("\xF4\x8F\xBF\xBF" "A");
+        ref.clear();
+        ref.setCursor(FONT_WIDTH + 1, 0);
+        ref.print("A");
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        gfx_.setCursor(0, 0);
+        printf("[PASS] testUtf8Print\n");
+    }
+
+    void testCurves() {
+        uint8_t reference[kBufferSize];
+        Gfx ref;
+        ref.init(reference, kTestWidth, kTestHeight);
+
+        // Залитая фигура = колонки между крайними пикселями её контура
+        for (int r = 0; r <= 20; ++r) {
+            ref.clear();
+            ref.circle(60, 31, r, true);
+            fillColumnsBetween(reference);
+            gfx_.clear();
+            gfx_.circleFill(60, 31, r, true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+
+        const int radii[][2] = {{1, 1}, {10, 4}, {4, 10}, {30, 20}, {60, 31}, {7, 0}, {0, 5}};
+        for (const auto& rr : radii) {
+            ref.clear();
+            ref.ellipse(63, 31, rr[0], rr[1], true);
+            // Крайние точки и симметрия контура
+            assert(getPixel(reference, 63 + rr[0], 31) && getPixel(reference, 63 - rr[0], 31));
+            assert(getPixel(reference, 63, 31 + rr[1]) && getPixel(reference, 63, 31 - rr[1]));
+            for (int y = 0; y < kTestHeight; ++y) {
+                for (int x = 1; x < kTestWidth - 1; ++x) {
+                    assert(getPixel(reference, x, y) == getPixel(reference, 126 - x, y));
+                }
+            }
+            fillColumnsBetween(reference);
+            gfx_.clear();
+            gfx_.ellipseFill(63, 31, rr[0], rr[1], true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+
+        // Окружность: все пиксели контура на расстоянии r +- 1
+        gfx_.clear();
+        gfx_.circle(64, 32, 25, true);
+        for (int y = 0; y < kTestHeight; ++y) {
+            for (int x = 0; x < kTestWidth; ++x) {
+                if (getPixel(buffer_, x, y)) {
+                    int d2 = (x - 64) * (x - 64) + (y - 32) * (y - 32);
+                    assert(d2 >= 24 * 24 && d2 <= 26 * 26);
+                }
+            }
+        }
+
+        // Скруглённый прямоугольник
+        const int rects[][5] = {{10, 5, 50, 30, 8}, {3, 3, 9, 40, 4}, {0, 0, 20, 7, 3}, {40, 10, 30, 20, 0}};
+        for (const auto& rc : rects) {
+            ref.clear();
+            ref.roundRect(rc[0], rc[1], rc[2], rc[3], rc[4], true);
+            if (rc[4] > 1) {
+                assert(!getPixel(reference, rc[0], rc[1]));
+            }
+            assert(getPixel(reference, rc[0] + rc[2] / 2, rc[1]));
+            assert(getPixel(reference, rc[0], rc[1] + rc[3] / 2));
+            fillColumnsBetween(reference);
+            gfx_.clear();
+            gfx_.roundRectFill(rc[0], rc[1], rc[2], rc[3], rc[4], true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+
+        // Дуги: 0..360 = окружность, четверть 0..90 - правый нижний квадрант
+        ref.clear();
+        ref.circle(64, 32, 20, true);
+        gfx_.clear();
+        gfx_.arc(64, 32, 20, 0, 360, true);
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        gfx_.clear();
+        gfx_.arc(64, 32, 20, 0, 90, true);
+        assert(getPixel(buffer_, 84, 32) && getPixel(buffer_, 64, 52));
+        for (int y = 0; y < kTestHeight; ++y) {
+            for (int x = 0; x < kTestWidth; ++x) {
+                if (getPixel(buffer_, x, y)) {
+                    assert(x >= 64 && y >= 32);
+                }
+            }
+        }
+        gfx_.arc(64, 32, 20, 90, 360, true);
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        gfx_.clear();
+        gfx_.arc(64, 32, 20, -90, 90, true);   // Правая половина
+        for (int y = 0; y < kTestHeight; ++y) {
+            for (int x = 0; x < 64; ++x) {
+                assert(!getPixel(buffer_, x, y));
+            }
+        }
+        assert(getPixel(buffer_, 64, 12) && getPixel(buffer_, 84, 32));
+
+        // Фигуры за краем экрана обрезаются
+        gfx_.clear();
+        gfx_.circleFill(-10, -10, 20, true);
+        gfx_.ellipseFill(130, 70, 20, 10, true);
+        gfx_.roundRectFill(120, 60, 30, 30, 10, true);
+        gfx_.arc(0, 0, 200, 0, 360, true);
+        assert(getPixel(buffer_, 0, 0));
+        assert(getPixel(buffer_, kTestWidth - 1, kTestHeight - 1));
+
+        // Радиусы на пределе 511: ошибка в int32 не переполняется - каждый
+        // пиксель контура соседствует с точкой по другую сторону эллипса
+        const int limits[][4] = {{-450, 32, 511, 511}, {-450, 32, 511, 30}, {64, -480, 30, 511}};
+        for (const auto& e : limits) {
+            const int64_t a2 = static_cast<int64_t>(e[2]) * e[2];
+            const int64_t b2 = static_cast<int64_t>(e[3]) * e[3];
+            auto side = [&](int x, int y) {
+                const int64_t dx = x - e[0];
+                const int64_t dy = y - e[1];
+                return b2 * dx * dx + a2 * dy * dy - a2 * b2 >= 0;
+            };
+            gfx_.clear();
+            gfx_.ellipse(e[0], e[1], e[2], e[3], true);
+            int drawn = 0;
+            for (int y = 0; y < kTestHeight; ++y) {
+                for (int x = 0; x < kTestWidth; ++x) {
+                    if (!getPixel(buffer_, x, y)) continue;
+                    ++drawn;
+                    bool crosses = false;
+                    for (int ny = y - 1; ny <= y + 1; ++ny) {
+                        for (int nx = x - 1; nx <= x + 1; ++nx) {
+                            crosses = crosses || side(nx, ny) != side(x, y);
+                        }
+                    }
+                    assert(crosses);
+                }
+            }
+            assert(drawn > 0);
+        }
+
+        printf("[PASS] testCurves\n");
+    }
+
+    void testPolygonFill() {
+        uint8_t reference[kBufferSize];
+        Gfx ref;
+        ref.init(reference, kTestWidth, kTestHeight);
+        PolygonEdge edges[8];
+
+        const Point needle[] = {{64, 60}, {60, 56}, {64, 8}, {68, 56}};
+        const Point star[] = {{64, 2}, {78, 60}, {30, 22}, {98, 22}, {50, 60}};      // Самопересечение
+        const Point concave[] = {{10, 10}, {60, 10}, {35, 30}, {60, 50}, {10, 50}};
+        const Point clipped[] = {{-20, -15}, {150, 5}, {100, 90}, {-5, 40}};
+        const Point tiny[] = {{5, 5}, {6, 5}, {5, 6}};
+        struct Shape { const Point* points; size_t count; };
+        const Shape shapes[] = {{needle, 4}, {star, 5}, {concave, 5}, {clipped, 4}, {tiny, 3}};
+
+        for (const Shape& shape : shapes) {
+            polygonReference(ref, reference, shape.points, shape.count);
+            gfx_.clear();
+            assert(gfx_.polygonFill(shape.points, shape.count, edges, 8, true));
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+
+        // Центр звезды при even-odd остаётся пустым
+        gfx_.clear();
+        gfx_.polygonFill(star, 5, edges, 8, true);
+        assert(!getPixel(buffer_, 64, 34));
+        assert(getPixel(buffer_, 64, 12));
+
+        // Треугольники: быстрый путь = таблица рёбер = эталон
+        uint32_t seed = 12345;
+        for (int i = 0; i < 200; ++i) {
+            Point t[3];
+            for (Point& p : t) {
+                seed = seed * 1103515245u + 12345u;
+                p.x = static_cast<int16_t>(static_cast<int>((seed >> 8) % 168) - 20);
+                seed = seed * 1103515245u + 12345u;
+                p.y = static_cast<int16_t>(static_cast<int>((seed >> 8) % 104) - 20);
+            }
+            polygonReference(ref, reference, t, 3);
+            gfx_.clear();
+            gfx_.triangleFill(t[0].x, t[0].y, t[1].x, t[1].y, t[2].x, t[2].y, true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+            gfx_.clear();
+            gfx_.polygonFill(t, 3, edges, 3, true);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+        }
+
+        // Вырожденные треугольники - отрезки
+        gfx_.clear();
+        gfx_.triangleFill(10, 10, 10, 30, 10, 20, true);
+        gfx_.triangleFill(20, 5, 40, 5, 30, 5, true);
+        ref.clear();
+        ref.line(10, 10, 10, 30, true);
+        ref.line(20, 5, 40, 5, true);
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        // Мало буфера рёбер или вершин - ничего не рисуется
+        gfx_.clear();
+        assert(!gfx_.polygonFill(star, 5, edges, 4, true));
+        assert(!gfx_.polygonFill(star, 2, edges, 8, true));
+        for (size_t i = 0; i < kBufferSize; ++i) {
+            assert(buffer_[i] == 0);
+        }
+        assert(gfx_.polygonFill(needle, 4, edges, 4, true));
+
+        printf("[PASS] testPolygonFill\n");
+    }
+
+    void testFixedSizeGfx() {
+        static_assert(Gfx128x64::BUFFER_SIZE == 1024, "128x64 buffer");
+        static_assert(sizeof(Gfx128x32().frame()) == 512, "128x32 frame is sized exactly");
+        static_assert(Gfx128x32::height() == 32, "compile-time height");
+
+        // Тот же рисунок, что и у Gfx с внешним буфером
+        static Gfx128x64 fixed;
+        assert(fixed.isInitialized() && fixed.buffer() == fixed.frame().data());
+        gfx_.clear();
+        fixed.clear();
+        for (Gfx* g : {&gfx_, static_cast<Gfx*>(&fixed)}) {
+            g->circleFill(40, 30, 12, true);
+            g->line(-10, 70, 140, -5, true);
+            g->setCursor(70, 40);
+            g->print("Fixed");
+        }
+        for (int y = -3; y < kTestHeight + 3; ++y) {
+            for (int x = -3; x < kTestWidth + 3; ++x) {
+                gfx_.pixel(x, y, ((x * 7 + y) % 5) == 0);
+                fixed.pixel(x, y, ((x * 7 + y) % 5) == 0);
+            }
+        }
+        assert(memcmp(buffer_, fixed.frame().data(), kBufferSize) == 0);
+
+        // Со сдвинутым кольцом: inline Gfx::pixel через Gfx& и константный pixel()
+        gfx_.setRingOrigin(3);
+        fixed.setRingOrigin(3);
+        Gfx& runtime = gfx_;
+        for (int y = -3; y < kTestHeight + 3; ++y) {
+            for (int x = -3; x < kTestWidth + 3; x += 3) {
+                runtime.pixel(x, y, ((x + y) & 4) != 0);
+                fixed.pixel(x, y, ((x + y) & 4) != 0);
+            }
+        }
+        assert(memcmp(buffer_, fixed.frame().data(), kBufferSize) == 0);
+        gfx_.setRingOrigin(0);
+        fixed.setRingOrigin(0);
+
+        // Dirty-регионы ведёт и встроенный pixel()
+        fixed.clearDirty();
+        fixed.pixel(100, 20, true);
+        uint8_t x0 = 0;
+        uint8_t x1 = 0;
+        assert(fixed.pageDirtyRange(2, x0, x1) && x0 == 100 && x1 == 100);
+        assert(!fixed.pageDirtyRange(0, x0, x1));
+
+        // 128x32: нижняя половина за границей
+        static Gfx128x32 half;
+        half.fill(true);
+        half.pixel(5, 32, false);
+        half.pixel(5, 31, false);
+        assert(half.frame()[3 * 128 + 5] == 0x7F);
+        half.clear();
+        for (uint8_t byte : half.frame()) {
+            assert(byte == 0);
+        }
+
+        printf("[PASS] testFixedSizeGfx\n");
+    }
+
+    void testTextRotated() {
+        uint8_t reference[kBufferSize];
+        const char* text = "Ab\xD0\xAF";   // "AbЯ"
+        const uint32_t codepoints[] = {'A', 'b', 0x042F};
+        const int count = 3;
+
+        for (Rotation rotation : {Rotation::R0, Rotation::R90, Rotation::R180, Rotation::R270}) {
+            const int x = 60;
+            const int y = 30;
+
+            // Эталон: обычный глиф, каждый пиксель переносится поворотом
+            memset(reference, 0, sizeof(reference));
+            static uint8_t cellBuf[kBufferSize];
+            Gfx cell;
+            cell.init(cellBuf, kTestWidth, kTestHeight);
+            for (int k = 0; k < count; ++k) {
+                cell.clear();
+                cell.drawGlyph(0, 0, codepoints[k], true, 1);
+                for (int gy = 0; gy < 8; ++gy) {
+                    for (int gx = 0; gx < 6; ++gx) {
+                        if (!pixelAt(cellBuf, kTestWidth, gx, gy)) continue;
+                        int px = x;
+                        int py = y;
+                        switch (rotation) {
+                            case Rotation::R0:   px += 6 * k + gx;     py += gy;             break;
+                            case Rotation::R90:  px += 7 - gy;         py += 6 * k + gx;     break;
+                            case Rotation::R180: px += -6 * k + 5 - gx; py += 7 - gy;        break;
+                            case Rotation::R270: px += gy;             py += -6 * k + 5 - gx; break;
+                        }
+                        reference[(py / 8) * kTestWidth + px] |= static_cast<uint8_t>(1 << (py % 8));
+                    }
+                }
+            }
+
+            gfx_.clear();
+            gfx_.setTextColor(true);
+            gfx_.drawTextRotated(x, y, text, rotation);
+            assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+            // Стирание цветом фона
+            gfx_.fill(true);
+            gfx_.setTextColor(false);
+            gfx_.drawTextRotated(x, y, text, rotation);
+            for (size_t i = 0; i < kBufferSize; ++i) {
+                assert(buffer_[i] == static_cast<uint8_t>(~reference[i]));
+            }
+        }
+        gfx_.setTextColor(true);
+
+        // За краем экрана - обрезка без записи за буфер
+        gfx_.clear();
+        gfx_.drawTextRotated(124, 60, "Clip", Rotation::R90);
+        gfx_.drawTextRotated(-3, 2, "Clip", Rotation::R270);
+
+        printf("[PASS] testTextRotated\n");
+    }
+
+    void testImageImport() {
+        // Нечётные размеры: неполные байты строки и неполная полоса
+        const int w = 21;
+        const int h = 13;
+        std::vector<uint8_t> image(w * h);
+        for (int i = 0; i < w * h; ++i) {
+            image[i] = static_cast<uint8_t>(((i * 7919) >> 3 ^ i) & 1);
+        }
+
+        const std::vector<uint8_t> files[] = {
+            encodePbm(image, w, h, false),
+            encodePbm(image, w, h, true),
+            encodeXbm(image, w, h),
+            encodeBmp(image, w, h, true),
+            encodeBmp(image, w, h, false),
+        };
+        const ImageFormat formats[] = {
+            ImageFormat::Pbm, ImageFormat::Pbm, ImageFormat::Xbm, ImageFormat::Bmp, ImageFormat::Bmp,
+        };
+        const int positions[][2] = {{0, 0}, {5, 3}, {-4, -6}, {120, 58}, {40, 27}};
+
+        uint8_t reference[kBufferSize];
+        for (size_t f = 0; f < sizeof(files) / sizeof(files[0]); ++f) {
+            for (const auto& pos : positions) {
+                // Чтение кусками по 1..3 байта - границы буфера потока
+                uint8_t changed[kBufferSize];
+                fillPattern();
+                memcpy(reference, buffer_, kBufferSize);
+                for (int y = 0; y < h; ++y) {
+                    for (int x = 0; x < w; ++x) {
+                        setRefPixel(reference, pos[0] + x, pos[1] + y, RasterOp::Copy, image[y * w + x] != 0);
+                    }
+                }
+                ChunkReader reader(files[f].data(), files[f].size());
+                ImageInfo info;
+                gfx_.clearDirty();
+                assert(ImageImport::draw(reader, gfx_, pos[0], pos[1], RasterOp::Copy, &info) == OledResult::Ok);
+                assert(info.width == w && info.height == h && info.format == formats[f]);
+                assert(memcmp(buffer_, reference, kBufferSize) == 0);
+                fillPattern();
+                for (size_t i = 0; i < kBufferSize; ++i) {
+                    changed[i] = static_cast<uint8_t>(buffer_[i] ^ reference[i]);
+                }
+                assertDirtyCovers(changed);
+            }
+        }
+
+        // Внеэкранный битмап: тот же результат через blit()
+        uint8_t bitmap[w * 2];
+        ImageInfo info;
+        MemoryReader pbm(files[0].data(), files[0].size());
+        assert(ImageImport::toBitmap(pbm, bitmap, sizeof(bitmap), info) == OledResult::Ok);
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                assert(pixelAt(bitmap, w, x, y) == (image[y * w + x] != 0));
+            }
+        }
+        MemoryReader small(files[2].data(), files[2].size());
+        assert(ImageImport::toBitmap(small, bitmap, sizeof(bitmap) - 1, info) == OledResult::InvalidArg);
+
+        // Изображение шире экрана: невидимые байты строк пропускаются
+        const int wideW = 200;
+        const int wideH = 9;
+        std::vector<uint8_t> wide(wideW * wideH);
+        for (int i = 0; i < wideW * wideH; ++i) {
+            wide[i] = static_cast<uint8_t>((i % 3 == 0) ^ (i % 7 == 0));
+        }
+        const std::vector<uint8_t> wideFile = encodeBmp(wide, wideW, wideH, true);
+        gfx_.clear();
+        memset(reference, 0, kBufferSize);
+        for (int y = 0; y < wideH; ++y) {
+            for (int x = 0; x < wideW; ++x) {
+                setRefPixel(reference, x - 37, y + 50, RasterOp::Copy, wide[y * wideW + x] != 0);
+            }
+        }
+        assert(ImageImport::draw(wideFile.data(), wideFile.size(), gfx_, -37, 50) == OledResult::Ok);
+        assert(memcmp(buffer_, reference, kBufferSize) == 0);
+
+        // Ошибки формата
+        MemoryReader header(files[3].data(), files[3].size());
+        assert(ImageImport::readInfo(header, info) == OledResult::Ok && info.width == w);
+        std::vector<uint8_t> truncated(files[0].begin(), files[0].end() - 2);
+        assert(ImageImport::draw(truncated.data(), truncated.size(), gfx_, 0, 0) == OledResult::InvalidArg);
+        const char gray[] = "P5 4 4 255\n";
+        assert(ImageImport::draw(reinterpret_cast<const uint8_t*>(gray), sizeof(gray) - 1, gfx_, 0, 0) ==
+               OledResult::Unsupported);
+        std::vector<uint8_t> color = files[3];
+        color[28] = 4;      // biBitCount
+        assert(ImageImport::draw(color.data(), color.size(), gfx_, 0, 0) == OledResult::Unsupported);
+        const char garbage[] = "GIF89a";
+        assert(ImageImport::draw(reinterpret_cast<const uint8_t*>(garbage), sizeof(garbage) - 1, gfx_, 0, 0) ==
+               OledResult::InvalidArg);
+        const char xbmByte[] = "#define a_width 8\n#define a_height 1\nchar a_bits[] = { 0x1FF };";
+        assert(ImageImport::draw(reinterpret_cast<const uint8_t*>(xbmByte), sizeof(xbmByte) - 1, gfx_, 0, 0) ==
+               OledResult::InvalidArg);
+
+        printf("[PASS] testImageImport\n");
+    }
+
+    void testRingOrigin() {
+        static uint8_t refBuf[kBufferSize];
+        Gfx ref;
+        ref.init(refBuf, kTestWidth, kTestHeight);
+        const int pages = kTestHeight / 8;
+        uint8_t sprite[16];
+        for (int i = 0; i < 16; ++i) {
+            sprite[i] = static_cast<uint8_t>(i * 37 + 5);
+        }
+
+        // Логическое изображение не зависит от начала кольца,
+        // физический буфер - то же изображение, повёрнутое на origin страниц
+        for (uint8_t origin = 0; origin < pages; ++origin) {
+            auto drawScene = [&sprite](Gfx& g) {
+                g.clear();
+                g.line(3, 2, 120, 61, true);
+                g.line(0, 60, 127, 5, true);
+                g.line(100, 63, 90, 0, true);
+                g.line(20, 0, 30, 63, true);
+                g.rectFill(0, 20, 128, 30, true);
+                g.rectFill(10, 3, 20, 58, false);
+                g.circle(64, 32, 30, true);
+                g.pixel(127, 63, true);
+                g.blit(50, 29, 8, 16, sprite, RasterOp::Xor);
+                g.copyRect(0, 50, 40, 14, 80, 1, RasterOp::Copy);
+                g.scroll(4, 6, 90, 51, -3, 11, true);
+                g.scroll(0, 0, 128, 64, 5, -13);
+                g.setCursor(2, 53);
+                g.print("Ring");
+            };
+            drawScene(ref);
+            gfx_.setRingOrigin(origin);
+            assert(gfx_.ringOrigin() == origin);
+            drawScene(gfx_);
+            for (int p = 0; p < pages; ++p) {
+                const size_t phys = static_cast<size_t>((p + origin) % pages) * kTestWidth;
+                assert(memcmp(buffer_ + phys, refBuf + static_cast<size_t>(p) * kTestWidth, kTestWidth) == 0);
+            }
+
+            // Dirty-регионы - физические страницы
+            gfx_.clearDirty();
+            gfx_.rectFill(5, 58, 3, 4, true);
+            for (int p = 0; p < pages; ++p) {
+                uint8_t x0 = 0;
+                uint8_t x1 = 0;
+                const bool dirty = gfx_.pageDirtyRange(static_cast<uint8_t>(p), x0, x1);
+                assert(dirty == (p == (7 + origin) % pages));
+                assert(!dirty || (x0 == 5 && x1 == 7));
+            }
+        }
+
+        // Прокрутка на страницу: бывшая верхняя страница становится нижней
+        gfx_.setRingOrigin(0);
+        gfx_.clear();
+        gfx_.rectFill(0, 8, kTestWidth, 8, true);
+        gfx_.setRingOrigin(9);      // По модулю числа страниц
+        assert(gfx_.ringOrigin() == 1);
+        gfx_.clearDirty();
+        gfx_.rectFill(0, 0, kTestWidth, 8, false);
+        uint8_t x0 = 0;
+        uint8_t x1 = 0;
+        assert(gfx_.pageDirtyRange(1, x0, x1) && !gfx_.pageDirtyRange(0, x0, x1));
+        for (size_t i = 0; i < kBufferSize; ++i) {
+            assert(buffer_[i] == 0);
+        }
+
+        // Gfx фиксированного размера: inline pixel() учитывает кольцо
+        static Gfx128x64 fixed;
+        fixed.clear();
+        fixed.setRingOrigin(3);
+        fixed.clearDirty();
+        fixed.pixel(1, 62, true);
+        assert(fixed.frame()[2 * 128 + 1] == 0x40);
+        assert(fixed.pageDirtyRange(2, x0, x1) && x0 == 1);
+        fixed.setRingOrigin(0);
+
+        // init() сбрасывает начало кольца
+        gfx_.init(buffer_, kTestWidth, kTestHeight);
+        assert(gfx_.ringOrigin() == 0);
+
+        printf("[PASS] testRingOrigin\n");
+    }
+
     void testCursor() {
         gfx_.setCursor(10, 20);
         // Внутреннее состояние курсора - проверяем косвенно через print
@@ -140,12 +1262,260 @@ public:
         testFill();
         testPixel();
         testLine();
+        testLineClipping();
         testRect();
+        testRectFill();
+        testDirtyTracking();
+        testGlyphBlit();
+        testBlit();
+        testCopyRectOverlap();
+        testScroll();
+        testSetBuffer();
+        testPageBitmap();
+        testProportionalFont();
+        testUnicodeRanges();
+        testTextLayout();
+        testUtf8Print();
+        testCurves();
+        testPolygonFill();
+        testFixedSizeGfx();
+        testTextRotated();
+        testImageImport();
+        testRingOrigin();
         testCursor();
         printf("=== All tests passed ===\n");
     }
 
 private:
+    void fillPattern() {
+        for (size_t i = 0; i < kBufferSize; ++i) {
+            buffer_[i] = static_cast<uint8_t>((i * 131) ^ (i >> 3));
+        }
+    }
+
+    static bool pixelAt(const uint8_t* buf, int width, int x, int y) {
+        return (buf[(y / 8) * width + x] >> (y % 8)) & 0x01;
+    }
+
+    // Источник, отдающий данные кусками по 1..3 байта
+    class ChunkReader : public IByteReader {
+    public:
+        ChunkReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+        size_t read(uint8_t* dst, size_t len) override {
+            size_t n = 1 + (calls_++ % 3);
+            if (n > len) n = len;
+            if (n > size_ - pos_) n = size_ - pos_;
+            memcpy(dst, data_ + pos_, n);
+            pos_ += n;
+            return n;
+        }
+
+    private:
+        const uint8_t* data_;
+        size_t size_;
+        size_t pos_ = 0;
+        size_t calls_ = 0;
+    };
+
+    static std::vector<uint8_t> encodePbm(const std::vector<uint8_t>& image, int w, int h, bool ascii) {
+        std::string text = ascii ? "P1\n# comment\n" : "P4\n# comment\n";
+        text += std::to_string(w) + " " + std::to_string(h) + "\n";
+        std::vector<uint8_t> out(text.begin(), text.end());
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; x += 8) {
+                uint8_t byte = 0;
+                for (int k = 0; k < 8 && x + k < w; ++k) {
+                    if (ascii) {
+                        out.push_back(static_cast<uint8_t>('0' + image[y * w + x + k]));
+                        out.push_back(k % 2 ? '\n' : ' ');
+                    }
+                    byte |= static_cast<uint8_t>(image[y * w + x + k] << (7 - k));
+                }
+                if (!ascii) out.push_back(byte);
+            }
+        }
+        return out;
+    }
+
+    static std::vector<uint8_t> encodeXbm(const std::vector<uint8_t>& image, int w, int h) {
+        std::string text = "/* test */\n#define test_width " + std::to_string(w) +
+                           "\n#define test_height " + std::to_string(h) +
+                           "\nstatic unsigned char test_bits[] = {\n";
+        char hex[8];
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; x += 8) {
+                unsigned byte = 0;
+                for (int k = 0; k < 8 && x + k < w; ++k) {
+                    byte |= static_cast<unsigned>(image[y * w + x + k]) << k;
+                }
+                snprintf(hex, sizeof(hex), "0x%02x, ", byte);
+                text += hex;
+            }
+        }
+        text += "};\n";
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    // BMP 1bpp: снизу вверх с палитрой {чёрный, белый} или сверху вниз с {белый, чёрный}
+    static std::vector<uint8_t> encodeBmp(const std::vector<uint8_t>& image, int w, int h, bool bottomUp) {
+        const int rowBytes = ((w + 31) / 32) * 4;
+        const uint32_t offset = 14 + 40 + 8;
+        std::vector<uint8_t> out(offset + static_cast<size_t>(rowBytes) * h, 0);
+        auto put = [&out](size_t at, uint32_t value, int bytes) {
+            for (int i = 0; i < bytes; ++i) out[at + i] = static_cast<uint8_t>(value >> (8 * i));
+        };
+        put(0, 0x4D42, 2);
+        put(2, static_cast<uint32_t>(out.size()), 4);
+        put(10, offset, 4);
+        put(14, 40, 4);
+        put(18, static_cast<uint32_t>(w), 4);
+        put(22, static_cast<uint32_t>(bottomUp ? h : -h), 4);
+        put(26, 1, 2);
+        put(28, 1, 2);
+        put(bottomUp ? 58 : 54, 0xFFFFFF, 4);  // Белый - фон
+        for (int y = 0; y < h; ++y) {
+            const size_t row = offset + static_cast<size_t>(bottomUp ? h - 1 - y : y) * rowBytes;
+            for (int x = 0; x < w; ++x) {
+                // Чернила - чёрный: индекс 0 снизу вверх, 1 сверху вниз
+                const bool bit = bottomUp ? !image[y * w + x] : image[y * w + x];
+                if (bit) out[row + x / 8] |= static_cast<uint8_t>(0x80 >> (x % 8));
+            }
+        }
+        return out;
+    }
+
+    static bool getPixel(const uint8_t* buf, int x, int y) {
+        return (buf[(y / 8) * kTestWidth + x] >> (y % 8)) & 0x01;
+    }
+
+    static void setRefPixel(uint8_t* buf, int x, int y, RasterOp op, bool src) {
+        if (x < 0 || x >= kTestWidth || y < 0 || y >= kTestHeight) {
+            return;
+        }
+        bool dst = getPixel(buf, x, y);
+        bool v = false;
+        switch (op) {
+            case RasterOp::Copy:   v = src; break;
+            case RasterOp::Or:     v = dst || src; break;
+            case RasterOp::And:    v = dst && src; break;
+            case RasterOp::Xor:    v = dst != src; break;
+            case RasterOp::AndNot: v = dst && !src; break;
+            case RasterOp::Not:    v = !src; break;
+        }
+        uint8_t bit = static_cast<uint8_t>(1 << (y % 8));
+        size_t idx = static_cast<size_t>(y / 8) * kTestWidth + x;
+        buf[idx] = v ? (buf[idx] | bit) : (buf[idx] & ~bit);
+    }
+
+    /**
+     * Эталон линии: точка на каждом шаге главной оси, вторая координата
+     * округляется (половина - от начала), концы упорядочены по главной оси
+     */
+    static void lineReference(uint8_t* buf, int x0, int y0, int x1, int y1) {
+        memset(buf, 0, kBufferSize);
+        const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+        if (steep) {
+            std::swap(x0, y0);
+            std::swap(x1, y1);
+        }
+        if (x0 > x1) {
+            std::swap(x0, x1);
+            std::swap(y0, y1);
+        }
+        const int64_t d = x1 - x0;
+        const int64_t a = std::abs(y1 - y0);
+        const int s = (y1 >= y0) ? 1 : -1;
+        for (int64_t t = 0; t <= d; ++t) {
+            int64_t off = (d == 0) ? 0 : (2 * t * a + d) / (2 * d);
+            int x = static_cast<int>(x0 + t);
+            int y = static_cast<int>(y0 + s * off);
+            if (steep) std::swap(x, y);
+            if (x >= 0 && x < kTestWidth && y >= 0 && y < kTestHeight) {
+                buf[(y / 8) * kTestWidth + x] |= static_cast<uint8_t>(1 << (y % 8));
+            }
+        }
+    }
+
+    // Каждый ненулевой байт попадает в dirty-диапазон своей страницы
+    void assertDirtyCovers(const uint8_t* buf) {
+        for (int page = 0; page < kTestHeight / 8; ++page) {
+            uint8_t x0 = 0;
+            uint8_t x1 = 0;
+            bool dirty = gfx_.pageDirtyRange(static_cast<uint8_t>(page), x0, x1);
+            for (int x = 0; x < kTestWidth; ++x) {
+                if (buf[page * kTestWidth + x]) {
+                    assert(dirty && x >= x0 && x <= x1);
+                }
+            }
+        }
+    }
+
+    /**
+     * Эталон заливки многоугольника: контур line() плюс пиксели, чей центр
+     * строго внутри по правилу even-odd (луч вверх, рёбра полуоткрыты по X)
+     */
+    static void polygonReference(Gfx& ref, uint8_t* buf, const Point* p, size_t count) {
+        ref.clear();
+        for (int y = 0; y < kTestHeight; ++y) {
+            for (int x = 0; x < kTestWidth; ++x) {
+                int crossings = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    Point a = p[i];
+                    Point b = p[(i + 1) % count];
+                    if (a.x == b.x) continue;
+                    if (a.x > b.x) std::swap(a, b);
+                    if (x < a.x || x >= b.x) continue;
+                    // y пересечения < y  <=>  (a.y - y) * dx + (x - a.x) * (b.y - a.y) < 0
+                    int64_t v = static_cast<int64_t>(a.y - y) * (b.x - a.x) +
+                                static_cast<int64_t>(x - a.x) * (b.y - a.y);
+                    if (v < 0) ++crossings;
+                }
+                if (crossings & 1) {
+                    buf[(y / 8) * kTestWidth + x] |= static_cast<uint8_t>(1 << (y % 8));
+                }
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const Point& a = p[i];
+            const Point& b = p[(i + 1) % count];
+            ref.line(a.x, a.y, b.x, b.y, true);
+        }
+    }
+
+    // Залить каждую колонку от верхнего до нижнего включённого пикселя
+    static void fillColumnsBetween(uint8_t* buf) {
+        for (int x = 0; x < kTestWidth; ++x) {
+            int top = -1;
+            int bottom = -1;
+            for (int y = 0; y < kTestHeight; ++y) {
+                if (getPixel(buf, x, y)) {
+                    if (top < 0) top = y;
+                    bottom = y;
+                }
+            }
+            for (int y = top; top >= 0 && y <= bottom; ++y) {
+                buf[(y / 8) * kTestWidth + x] |= static_cast<uint8_t>(1 << (y % 8));
+            }
+        }
+    }
+
+    static void drawReferenceChar(Gfx& ref, int x, int y, char c, bool color, uint8_t scale) {
+        const uint8_t* glyph = &FONT_5X7[(c - FONT_FIRST_CHAR) * FONT_WIDTH];
+        for (int col = 0; col < FONT_WIDTH; ++col) {
+            for (int row = 0; row < FONT_HEIGHT; ++row) {
+                if (!((glyph[col] >> row) & 0x01)) {
+                    continue;
+                }
+                for (int sy = 0; sy < scale; ++sy) {
+                    for (int sx = 0; sx < scale; ++sx) {
+                        ref.pixel(x + col * scale + sx, y + row * scale + sy, color);
+                    }
+                }
+            }
+        }
+    }
+
     uint8_t buffer_[kBufferSize];
     Gfx gfx_;
 };
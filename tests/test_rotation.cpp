@@ -0,0 +1,143 @@
+/**
+ * @file test_rotation.cpp
+ * @brief Unit-тесты программного поворота кадра (OLED_SOFT_ROTATION=1)
+ *
+ * Портретный холст 64x128 - 16 страниц dirty-регионов, поэтому тест
+ * собирается отдельно от test_gfx, который проверяет конфигурацию по умолчанию.
+ * Цель test_rotation_portable собирает тот же файл с OLED_NO_SIMD=1: на host
+ * выполняется переносимое ядро транспонирования, которое работает на Cortex-M.
+ */
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+// Для host-тестирования определяем минимальную конфигурацию
+#define OLED_SSD1315_ENABLE 1
+#define OLED_USE_ARDUINO 0
+#define OLED_USE_STM32HAL 0
+#define OLED_ENABLED 1
+
+#include "../include/oled/domain/Gfx.hpp"
+#include "../include/oled/domain/FrameRotate.hpp"
+
+using namespace oled;
+
+namespace {
+
+constexpr uint16_t kTestWidth = 128;
+constexpr uint16_t kTestHeight = 64;
+constexpr size_t kBufferSize = (kTestWidth * kTestHeight) / 8;
+
+static_assert(Gfx::MAX_PAGES == kTestWidth / 8, "test_rotation: needs OLED_SOFT_ROTATION=1");
+
+class RotationTest {
+public:
+    RotationTest() {
+        memset(buffer_, 0, sizeof(buffer_));
+        gfx_.init(buffer_, kTestWidth, kTestHeight);
+    }
+
+    void testFrameRotate() {
+        // Транспонирование против побитового эталона
+        uint32_t seed = 99;
+        for (int n = 0; n < 1000; ++n) {
+            uint8_t in[8];
+            uint8_t out[8];
+            uint8_t back[8];
+            for (uint8_t& b : in) {
+                seed = seed * 1103515245u + 12345u;
+                b = static_cast<uint8_t>(seed >> 16);
+            }
+            FrameRotate::transpose8x8(in, out);
+            for (int i = 0; i < 8; ++i) {
+                for (int j = 0; j < 8; ++j) {
+                    assert(((out[i] >> j) & 1) == ((in[j] >> i) & 1));
+                }
+            }
+            FrameRotate::transpose8x8(out, back);
+            assert(memcmp(in, back, 8) == 0);
+            // На месте: in == out
+            FrameRotate::transpose8x8(back, back);
+            assert(memcmp(out, back, 8) == 0);
+        }
+
+        // Портретный холст 64x128 -> панель 128x64
+        static uint8_t logicalBuf[kBufferSize];
+        Gfx logical;
+        logical.init(logicalBuf, kTestHeight, kTestWidth);
+        for (int y = 0; y < kTestWidth; ++y) {
+            for (int x = 0; x < kTestHeight; ++x) {
+                seed = seed * 1103515245u + 12345u;
+                logical.pixel(x, y, (seed >> 20) & 1);
+            }
+        }
+        logical.setCursor(2, 2);
+        logical.print("Portrait");
+
+        for (Rotation rotation : {Rotation::R90, Rotation::R270}) {
+            logical.markAllDirty();
+            gfx_.clear();
+            gfx_.clearDirty();
+            FrameRotate::rotate(logical, gfx_, rotation);
+            for (int y = 0; y < kTestHeight; ++y) {
+                for (int x = 0; x < kTestWidth; ++x) {
+                    // R90: холст (lx, ly) -> панель (W - 1 - ly, lx)
+                    int lx = (rotation == Rotation::R90) ? y : kTestHeight - 1 - y;
+                    int ly = (rotation == Rotation::R90) ? kTestWidth - 1 - x : x;
+                    assert(getPixel(buffer_, x, y) == pixelAt(logicalBuf, kTestHeight, lx, ly));
+                }
+            }
+            assert(gfx_.isDirty());
+        }
+
+        // Пересчитывается только изменённый блок
+        gfx_.clearDirty();
+        logical.clearDirty();
+        logical.pixel(10, 20, !pixelAt(logicalBuf, kTestHeight, 10, 20));
+        FrameRotate::rotate(logical, gfx_, Rotation::R270);
+        assert(getPixel(buffer_, 20, kTestHeight - 1 - 10) == pixelAt(logicalBuf, kTestHeight, 10, 20));
+        uint8_t x0 = 0;
+        uint8_t x1 = 0;
+        for (uint8_t page = 0; page < kTestHeight / 8; ++page) {
+            bool dirty = gfx_.pageDirtyRange(page, x0, x1);
+            assert(dirty == (page == (kTestHeight - 1 - 10) / 8));
+            if (dirty) {
+                assert(x0 == 16 && x1 == 23);
+            }
+        }
+
+        // R0 и R180 холст не трогают
+        gfx_.clearDirty();
+        FrameRotate::rotate(logical, gfx_, Rotation::R180);
+        assert(!gfx_.isDirty());
+
+        printf("[PASS] testFrameRotate\n");
+    }
+
+    void runAll() {
+        printf("=== Rotation Unit Tests ===\n");
+        testFrameRotate();
+        printf("=== All tests passed ===\n");
+    }
+
+private:
+    static bool getPixel(const uint8_t* buf, int x, int y) {
+        return (buf[(y / 8) * kTestWidth + x] >> (y % 8)) & 0x01;
+    }
+
+    static bool pixelAt(const uint8_t* buf, int width, int x, int y) {
+        return (buf[(y / 8) * width + x] >> (y % 8)) & 0x01;
+    }
+
+    uint8_t buffer_[kBufferSize];
+    Gfx gfx_;
+};
+
+} // anonymous namespace
+
+int main() {
+    RotationTest test;
+    test.runAll();
+    return 0;
+}